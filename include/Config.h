@@ -25,11 +25,25 @@
 // LED configuration for the hoop.
 #define NUM_LEDS 288  ///< Number of LEDs in the hoop.
 #define LEDS_PIN 11  ///< Pin number to which the LEDs are connected.
+#define FRAME_CACHE_BYTES 32768  ///< RAM budget for the frames cached by image scrolling effects.
+
+// Profiling configuration.
+#define EFFECT_PROFILING 0  ///< Set to 1 to report the average effect render time over Serial.
+#define EFFECT_PROFILING_FRAMES 100  ///< Number of frames averaged per profiling report.
+#define IMAGE_PROFILING 0  ///< Set to 1 to report the image decoding time over Serial at startup.
+#define IMAGE_PROFILING_PASSES 100  ///< Number of times every image column is decoded per profiling report.
+#define POV_PROFILING 0  ///< Set to 1 to report the column timing of the persistence-of-vision effect over Serial.
+#define POV_PROFILING_MICROS 1000000  ///< Period of the persistence-of-vision timing reports, in microseconds.
 
 // Bluetooth's configuration.
 #define EFFECT_SERVICE_UUID "0A92"  ///< UUID for the effect service.
 #define SCOLOR_SERVICE_UUID "0A93"  ///< UUID for the solid color service.
 #define ENERGY_SERVICE_UUID "0A95"  ///< UUID for the energy saving service.
+#define PALETTE_SERVICE_UUID "0A96"  ///< UUID for the palette upload service.
+#define PALETTE_MAX_STOPS 16  ///< Maximum number of gradient stops in an uploaded palette.
+#define AUTOMATON_SERVICE_UUID "0A97"  ///< UUID for the cellular automaton rule service.
+#define TEXT_SERVICE_UUID "0A98"  ///< UUID for the text message service.
+#define TEXT_MAX_LENGTH 64  ///< Maximum number of characters of a text message.
 #define MANUFACTURER_CHARACTERISTIC "OpenHoop"  ///< Manufacturer characteristic.
 #define MODEL_CHARACTERISTIC "HulaHoopBLE"  ///< Model characteristic.
 #define SERIAL_NUMBER_CHARACTERISTIC "HH-BLE-1"  ///< Serial number characteristic.
@@ -0,0 +1,64 @@
+/**
+ * @project OpenHoop
+ * @file AutomatonEffect.h
+ * @brief Header file for the AutomatonEffect class, representing an LED effect running a cellular automaton.
+ * @details Defines the AutomatonEffect class, which steps a cellular automaton over the pixels of the hoop and colors
+ * the live and decaying cells through a palette that shifts with the generations.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_AUTOMATONEFFECT_H
+#define OPENHOOP_AUTOMATONEFFECT_H
+
+#include "Effect.h"
+#include "../utils/CellularAutomaton.h"
+#include "../utils/FastRandom.h"
+#include "../utils/Palette.h"
+
+/**
+ * @brief Represents an LED effect running a cellular automaton.
+ */
+class AutomatonEffect : public Effect {
+public:
+    /**
+     * @brief Constructor for the AutomatonEffect class.
+     * @param ruleCode Rule of the automaton, as decoded by AutomatonRule::fromCode.
+     * @param seed Seed of the random initial cells, a fixed seed replaying the same run.
+     */
+    explicit AutomatonEffect(uint32_t ruleCode, uint32_t seed = FastRandom::DEFAULT_SEED);
+
+    /**
+     * @brief Start the automaton effect.
+     */
+    void start() override;
+
+    /**
+     * @brief Update the automaton effect.
+     */
+    void update() override;
+
+    /**
+     * @brief Stop the automaton effect.
+     */
+    void stop() override;
+
+    /**
+     * @brief Replace the palette of the automaton effect.
+     */
+    void setPalette(const Palette256& newPalette) override;
+
+private:
+    /**
+     * @brief Clear the automaton and seed it again.
+     */
+    void restart();
+
+    AutomatonRule rule;            ///< Rule of the automaton.
+    CellularAutomaton automaton;   ///< Cells of the automaton, one per pixel.
+    FastRandom seedRandom;         ///< Generator of the initial cells.
+    Palette256 palette;            ///< Colors of the cells.
+};
+
+#endif //OPENHOOP_AUTOMATONEFFECT_H
@@ -41,8 +41,6 @@ public:
 private:
     int waveSpeed;    ///< Speed of the color wave.
     int hueOffset;    ///< Offset to control the color wave pattern.
-    int saturation;   ///< Saturation level of the colors.
-    int brightness;   ///< Brightness level of the colors.
 };
 
 #endif //COLORWAVEEFFECT_H
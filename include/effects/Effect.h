@@ -2,7 +2,8 @@
  * @project OpenHoop
  * @file Effect.h
  * @brief Header file for the Effect class, representing an abstract base class for LED effects.
- * @details Defines the Effect class with pure virtual methods for starting, updating, and stopping an LED effect.
+ * @details Defines the Effect class with pure virtual methods for starting, updating, and stopping an LED effect, and an
+ * optional hook to change its palette.
  * @author github.com/angelcamelot
  * @date 2024-03-17
  * @license Open-source license.
@@ -11,6 +12,8 @@
 #ifndef OPENHOOP_EFFECT_H
 #define OPENHOOP_EFFECT_H
 
+class Palette256;
+
 /**
  * @brief Abstract base class representing an LED effect.
  */
@@ -31,6 +34,12 @@ public:
   */
  virtual void stop() = 0;
 
+ /**
+  * @brief Replace the colors of the effect, for effects that render through a palette.
+  * @param palette Palette to render with, copied by the effect.
+  */
+ virtual void setPalette(const Palette256& /*palette*/) {}
+
  /**
   * @brief Virtual destructor for the base class.
   */
@@ -2,7 +2,8 @@
  * @project OpenHoop
  * @file FireEffect.h
  * @brief Header file for the FireEffect class, representing an LED effect simulating a fire.
- * @details Defines the FireEffect class and its methods for starting, updating, and stopping the fire effect.
+ * @details Defines the FireEffect class and its methods for starting, updating, and stopping the fire effect. The fire
+ * is a heat field along the two arcs of the hoop, rising from a base that follows gravity.
  * @author github.com/angelcamelot
  * @date 2024-03-17
  * @license Open-source license.
@@ -12,6 +13,9 @@
 #define FIREEFFECT_H
 
 #include "Effect.h"
+#include "../Config.h"
+#include "../utils/FastRandom.h"
+#include "../utils/Palette.h"
 
 /**
  * @brief Represents an LED effect simulating a fire.
@@ -20,8 +24,9 @@ class FireEffect : public Effect {
 public:
     /**
      * @brief Constructor for the FireEffect class.
+     * @param seed Seed of the random sparks, a fixed seed replaying the same fire.
      */
-    FireEffect();
+    explicit FireEffect(uint32_t seed = FastRandom::DEFAULT_SEED);
 
     /**
      * @brief Start the fire effect.
@@ -38,11 +43,32 @@ public:
      */
     void stop() override;
 
+    /**
+     * @brief Replace the heat palette of the fire effect.
+     */
+    void setPalette(const Palette256& newPalette) override;
+
 private:
-    int cooling;         ///< Rate of cooling, affecting fading.
-    int sparking;        ///< Rate of sparking, affecting intensity variations.
-    int numZones;        ///< Number of zones to divide the hoop.
-    int* zoneIntensity;  ///< Intensity of each zone.
+    static constexpr uint16_t ARC_CAPACITY = (NUM_LEDS + 1) / 2;  ///< Maximum number of cells along each arc.
+
+    /**
+     * @brief Move the base of the flames towards the bottom of the hoop, as measured by the accelerometer.
+     */
+    void updateBase();
+
+    /**
+     * @brief Advance the heat along one arc by a frame: cooling, rising and sparking.
+     * @param arc Heat of each cell, starting at the base.
+     * @param length Number of cells along the arc.
+     */
+    void simulateArc(uint8_t* arc, uint16_t length);
+
+    uint8_t cooling;        ///< How fast the flames cool down, higher values giving shorter flames.
+    uint8_t sparking;       ///< Chance out of 255 that a spark ignites near the base of each arc per frame.
+    uint16_t baseAngle;     ///< Position of the base around the hoop, a full turn spanning 65536.
+    uint8_t heat[2][ARC_CAPACITY];  ///< Heat of each cell of both arcs, rising from the base in opposite directions.
+    FastRandom sparkRandom;  ///< Generator of the cooling and the sparks.
+    Palette256 palette;      ///< Colors indexed by heat.
 };
 
 #endif //FIREEFFECT_H
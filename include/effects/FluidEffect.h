@@ -0,0 +1,65 @@
+/**
+ * @project OpenHoop
+ * @file FluidEffect.h
+ * @brief Header file for the FluidEffect class, representing an LED effect of liquid sloshing around the hoop.
+ * @details Defines the FluidEffect class, which runs a shallow-water simulation driven by the accelerometer, so the
+ * liquid runs to the low side of the hoop as it tilts and taps on the hoop start ripples.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_FLUIDEFFECT_H
+#define OPENHOOP_FLUIDEFFECT_H
+
+#include "Effect.h"
+#include "../utils/FluidSimulation.h"
+#include "../utils/Palette.h"
+
+/**
+ * @brief Represents an LED effect of liquid sloshing around the hoop.
+ */
+class FluidEffect : public Effect {
+public:
+    /**
+     * @brief Constructor for the FluidEffect class.
+     */
+    FluidEffect();
+
+    /**
+     * @brief Start the fluid effect.
+     */
+    void start() override;
+
+    /**
+     * @brief Update the fluid effect.
+     */
+    void update() override;
+
+    /**
+     * @brief Stop the fluid effect.
+     */
+    void stop() override;
+
+    /**
+     * @brief Replace the palette of the fluid effect.
+     */
+    void setPalette(const Palette256& newPalette) override;
+
+private:
+    static constexpr uint8_t SUBSTEPS = 4;  ///< Simulation steps per frame.
+
+    /**
+     * @brief Read the accelerometer and start a ripple when the reading jumps away from the filtered gravity.
+     */
+    void updateGravity();
+
+    uint16_t level;           ///< Depth of each cell when the liquid is at rest, 256 per pixel.
+    int32_t gravityX;         ///< Last gravity read along the X axis, 4096 per g.
+    int32_t gravityY;         ///< Last gravity read along the Y axis, 4096 per g.
+    TapDetector taps;         ///< Taps on the hoop, found from the jumps in gravity.
+    FluidSimulation fluid;    ///< Liquid, one cell per pixel.
+    Palette256 palette;       ///< Colors indexed by depth.
+};
+
+#endif //OPENHOOP_FLUIDEFFECT_H
@@ -12,7 +12,7 @@
 #define FUNKYEFFECT_H
 
 #include "Effect.h"
-#include "../utils/EffectUtils.h"
+#include "../utils/Palette.h"
 
 class FunkyEffect : public Effect {
 public:
@@ -21,10 +21,12 @@ public:
     void start() override;
     void update() override;
     void stop() override;
+    void setPalette(const Palette256& newPalette) override;
 
 private:
-    int time;
-    uint32_t colors[5]{};
+    static constexpr uint16_t ANGLE_STEP = 1043;  ///< 0.1 radians as a 16-bit angle.
+    uint16_t phase;  ///< Sine angle of the first pixel, a full turn spanning 65536.
+    Palette256 palette;  ///< Palette the sine sweeps through.
 };
 
 #endif // FUNKYEFFECT_H
@@ -0,0 +1,248 @@
+/**
+ * @project OpenHoop
+ * @file ImageScrollerEffect.h
+ * @brief Header file for the ImageScrollerEffect class template, an LED effect scrolling any image across the hoop.
+ * @details Defines the ImageScrollerEffect class template, which shows one column of an image along the hoop and scrolls
+ * through the columns at a fixed-point speed, blending the two columns around fractional positions. Each column is
+ * resampled to a span of pixels through a precomputed row table, tiling it along the hoop or stretching it around it,
+ * and laid over a background wherever the image is transparent.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_IMAGESCROLLEREFFECT_H
+#define OPENHOOP_IMAGESCROLLEREFFECT_H
+
+#include <memory>
+#include <type_traits>
+#include "Effect.h"
+#include "../Config.h"
+#include "../images/LedImage.h"
+#include "../utils/FrameCache.h"
+
+/**
+ * @brief Represents an LED effect scrolling an image across the hoop.
+ * @tparam Image Image class, derived from LedImage.
+ */
+template<typename Image>
+class ImageScrollerEffect : public Effect {
+    static_assert(std::is_base_of<LedImage, Image>::value, "Images must derive from LedImage");
+
+public:
+    static constexpr uint16_t NATIVE_SPAN = 0;  ///< Span of one pixel per image row, tiling the image along the hoop.
+    static constexpr uint16_t AROUND_HOOP = 0xFFFF;  ///< Span stretching the image once around the hoop.
+
+    /**
+     * @brief Constructor for the ImageScrollerEffect class.
+     * @param image Image to scroll.
+     * @param background Color shown through the transparent pixels of the image.
+     * @param speed Columns scrolled per frame, in 8.8 fixed point.
+     * @param span Number of pixels each column is resampled to, NATIVE_SPAN or AROUND_HOOP. Shorter spans than the hoop
+     * are repeated along it.
+     */
+    explicit ImageScrollerEffect(const Image& image, RgbColor background = RgbColor(), uint16_t speed = 256,
+                                 uint16_t span = NATIVE_SPAN)
+        : image(image), background(background), speed(speed), span(span) {}
+
+    /**
+     * @brief Start the image scroller effect.
+     * @details The row table and the frame cache are set up by the first update, once the active pixels are known.
+     */
+    void start() override {
+        position = 0;
+        tablePixels = 0;
+    }
+
+    /**
+     * @brief Update the image scroller effect.
+     * @details The background only depends on the pixel, so each scroll position always gives the same frame and
+     * frames come from the frame cache once rendered. Scrolls visiting more positions than the cache holds would evict
+     * every frame before it is shown again, so they render each frame and never allocate the cache.
+     */
+    void update() override {
+        const uint32_t end = static_cast<uint32_t>(image.width) << 8;
+        if (end == 0) {
+            return;
+        }
+        position = (position + speed) % end;
+
+        RgbColor* frame = hoop.getFrame();
+        const uint16_t pixels = hoop.getActivePixels();
+        if (pixels != tablePixels) {
+            buildRowTable(pixels);
+            prepareFrameCache(pixels);
+        }
+        if (!frameCache) {
+            render(frame, pixels);
+        } else if (!frameCache->fetch(position, frame, pixels)) {
+            render(frame, pixels);
+            frameCache->store(position, frame, pixels);
+        }
+        hoop.show();
+    }
+
+    /**
+     * @brief Stop the image scroller effect, freeing the frame cache.
+     */
+    void stop() override {
+        frameCache.reset();
+        hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+    }
+
+protected:
+    /**
+     * @brief Fill the frame with the background shown through the transparent pixels of the image.
+     * @details Overrides must only depend on the pixel index, as frames are cached by scroll position.
+     * @param frame Frame to fill.
+     * @param pixels Number of pixels of the frame.
+     */
+    virtual void renderBackground(RgbColor* frame, uint16_t pixels) {
+        for (uint16_t i = 0; i < pixels; i++) {
+            frame[i] = background;
+        }
+    }
+
+    /**
+     * @brief Replace a palette entry of the image, dropping the frames cached with the old color.
+     * @param index Palette index, entries past LedImage::MAX_COLORS being ignored.
+     * @param color New color of the entry.
+     */
+    void setPaletteColor(uint8_t index, const LedColor& color) {
+        image.setPaletteColor(index, color);
+        clearFrameCache();
+    }
+
+    /**
+     * @brief Replace the color shown through the transparent pixels, dropping the frames cached with the old one.
+     */
+    void setBackground(RgbColor color) {
+        background = color;
+        clearFrameCache();
+    }
+
+    /**
+     * @brief Get the image being scrolled.
+     * @details The image is read-only to derived effects, so that every change goes through a setter clearing the
+     * frame cache.
+     */
+    const Image& getImage() const {
+        return image;
+    }
+
+private:
+    /**
+     * @brief Precompute the image row and blend weight of each pixel of the span.
+     * @details Pixel j of a span of length s samples the image at row j * height / s, in 8.8 fixed point. A span of
+     * exactly the image height gives whole rows, reproducing the image pixel for pixel.
+     */
+    void buildRowTable(uint16_t pixels) {
+        const int height = image.height < LedImage::MAX_HEIGHT ? image.height : LedImage::MAX_HEIGHT;
+        spanLength = span == NATIVE_SPAN ? height : span == AROUND_HOOP ? pixels : span;
+        spanLength = spanLength < NUM_LEDS ? spanLength : NUM_LEDS;
+        spanLength = spanLength > 0 ? spanLength : 1;
+
+        for (uint16_t j = 0; j < spanLength; j++) {
+            const uint32_t row = (static_cast<uint32_t>(j) * height << 8) / spanLength;
+            rowIndex[j] = row >> 8;
+            rowWeight[j] = row & 0xFF;
+        }
+        tablePixels = pixels;
+    }
+
+    /**
+     * @brief Allocate an empty frame cache if every scroll position fits in it, and free it otherwise.
+     * @details The cache is only allocated once the effect runs, so an effect built while the previous one still holds
+     * its cache costs no cache memory, and neither do scrolls too long to cache, such as most texts.
+     */
+    void prepareFrameCache(uint16_t pixels) {
+        if (countPositions() > FrameCache::getCapacity(pixels)) {
+            frameCache.reset();
+        } else if (frameCache) {
+            frameCache->clear();
+        } else {
+            frameCache = std::make_unique<FrameCache>();
+        }
+    }
+
+    /**
+     * @brief Drop the cached frames, if there is a frame cache.
+     */
+    void clearFrameCache() {
+        if (frameCache) {
+            frameCache->clear();
+        }
+    }
+
+    /**
+     * @brief Count the scroll positions visited before the scroll comes back to the start.
+     * @details Stepping by the speed around the image width in 8.8 fixed point visits every multiple of their greatest
+     * common divisor, so speeds of whole columns visit one position per column and fractional speeds many more.
+     */
+    uint32_t countPositions() const {
+        const uint32_t end = static_cast<uint32_t>(image.width) << 8;
+        uint32_t divisor = end;
+        uint32_t remainder = speed % end;
+        while (remainder != 0) {
+            const uint32_t next = divisor % remainder;
+            divisor = remainder;
+            remainder = next;
+        }
+        return end / divisor;
+    }
+
+    /**
+     * @brief Render the image at the current scroll position over the background.
+     * @details The two columns around the position are blended once, then each pixel blends the two rows around its
+     * sample and is laid over the background by its alpha.
+     */
+    void render(RgbColor* frame, uint16_t pixels) {
+        renderBackground(frame, pixels);
+
+        const int x = position >> 8;
+        const uint8_t weight = position & 0xFF;
+        const LedColumn first = image.column(x);
+        const int height = first.height;
+        if (height == 0) {
+            return;
+        }
+
+        LedColor mixed[LedImage::MAX_HEIGHT];
+        for (int y = 0; y < height; y++) {
+            mixed[y] = first.pixels[y];
+        }
+        if (weight > 0) {
+            const LedColumn second = image.column(x + 1 < image.width ? x + 1 : 0);
+            for (int y = 0; y < height; y++) {
+                mixed[y] = LedColor::lerp8(mixed[y], second.pixels[y], weight);
+            }
+        }
+
+        uint16_t j = 0;
+        for (uint16_t i = 0; i < pixels; i++) {
+            const uint8_t row = rowIndex[j];
+            const LedColor color = LedColor::lerp8(mixed[row], mixed[row + 1 < height ? row + 1 : 0], rowWeight[j]);
+            frame[i] = RgbColor(color.red, color.green, color.blue) + frame[i].scale8(255 - color.alpha);
+            j = j + 1 < spanLength ? j + 1 : 0;
+        }
+    }
+
+    Image image;               ///< Image being scrolled.
+    RgbColor background;       ///< Color shown through the transparent pixels by default.
+    uint16_t speed;            ///< Columns scrolled per frame, in 8.8 fixed point.
+    uint16_t span;             ///< Requested span, NATIVE_SPAN, AROUND_HOOP or a number of pixels.
+    uint32_t position = 0;     ///< Scroll position in columns, in 8.8 fixed point.
+    uint16_t tablePixels = 0;  ///< Number of active pixels the row table was built for, 0 before it is built.
+    uint16_t spanLength = 1;   ///< Number of pixels each column is resampled to.
+    uint8_t rowIndex[NUM_LEDS] = {};   ///< Image row sampled by each pixel of the span.
+    uint8_t rowWeight[NUM_LEDS] = {};  ///< Weight of the next row at each pixel of the span, out of 256.
+    std::unique_ptr<FrameCache> frameCache;  ///< Frames already rendered, keyed by scroll position, null if not cached.
+};
+
+template<typename Image>
+constexpr uint16_t ImageScrollerEffect<Image>::NATIVE_SPAN;
+
+template<typename Image>
+constexpr uint16_t ImageScrollerEffect<Image>::AROUND_HOOP;
+
+#endif //OPENHOOP_IMAGESCROLLEREFFECT_H
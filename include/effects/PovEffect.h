@@ -0,0 +1,153 @@
+/**
+ * @project OpenHoop
+ * @file PovEffect.h
+ * @brief Header file for the PovEffect class template, a persistence-of-vision effect painting an image in the air.
+ * @details Defines the PovEffect class template, which tracks the rotation of the hoop with the gyroscope and switches
+ * the image column shown along the hoop as it turns past the angle of each column, so the spinning hoop draws the
+ * image around it. Columns are sent with the partial show of the hoop, which refreshes the strip far faster than full
+ * frames.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_POVEFFECT_H
+#define OPENHOOP_POVEFFECT_H
+
+#include <type_traits>
+#include "Effect.h"
+#include "../Config.h"
+#include "../images/LedImage.h"
+#include "../utils/EffectUtils.h"
+#include "../utils/PovScheduler.h"
+#include "../utils/RotationTracker.h"
+
+/**
+ * @brief Represents a persistence-of-vision effect painting an image in the air as the hoop spins.
+ * @tparam Image Image class, derived from LedImage.
+ */
+template<typename Image>
+class PovEffect : public Effect {
+    static_assert(std::is_base_of<LedImage, Image>::value, "Images must derive from LedImage");
+
+public:
+    /**
+     * @brief Constructor for the PovEffect class.
+     * @param image Image to paint.
+     * @param columnsPerTurn Number of image columns shown per turn of the hoop, 0 spreading the image once around it.
+     * @param pixels Number of pixels showing each column from the start of the strip, the column being repeated along
+     * them; 0 shows it once. Fewer pixels refresh faster.
+     */
+    explicit PovEffect(const Image& image, uint16_t columnsPerTurn = 0, uint16_t pixels = 0)
+        : image(image), columnsPerTurn(columnsPerTurn ? columnsPerTurn : image.width), pixels(pixels) {}
+
+    /**
+     * @brief Start the persistence-of-vision effect.
+     * @details Blanks the whole strip once, as the partial show leaves the pixels past the column untouched.
+     */
+    void start() override {
+        tracker.reset();
+        scheduler.reset(columnsPerTurn);
+        showMicros = 0;
+        reportStart = micros();
+        hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+        hoop.show();
+    }
+
+    /**
+     * @brief Update the persistence-of-vision effect.
+     * @details The angle is read ahead by the duration of the last show, so each column is latched by the strip as the
+     * hoop reaches its angle rather than one transfer later.
+     */
+    void update() override {
+        int32_t rate;
+        const uint32_t now = micros();
+        if (EffectUtils::getRotationRate(rate)) {
+            tracker.addReading(rate, now);
+        }
+
+        uint16_t column;
+        if (scheduler.poll(tracker.getAngle(now + showMicros), tracker.getRate(), column)) {
+            showColumn(column);
+        }
+
+#if POV_PROFILING
+        report(now);
+#endif
+    }
+
+    /**
+     * @brief Stop the persistence-of-vision effect.
+     */
+    void stop() override {
+        hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+        hoop.show();
+    }
+
+protected:
+    Image image;  ///< Image being painted.
+
+private:
+    /**
+     * @brief Draw an image column along the strip and send it.
+     * @details Columns per turn other than the image width are mapped proportionally onto the image columns.
+     */
+    void showColumn(uint16_t column) {
+        const LedColumn colors = image.column(static_cast<int>(static_cast<uint32_t>(column) * image.width /
+                                                                columnsPerTurn));
+        if (colors.height == 0) {
+            return;
+        }
+
+        const uint16_t active = hoop.getActivePixels();
+        const uint16_t count = pixels > 0 && pixels < active ? pixels : colors.height < active ? colors.height : active;
+        RgbColor* frame = hoop.getFrame();
+        int y = 0;
+        for (uint16_t i = 0; i < count; i++) {
+            // Transparent pixels are black, so the colors are shown as they are
+            frame[i] = RgbColor(colors.pixels[y].red, colors.pixels[y].green, colors.pixels[y].blue);
+            y = y + 1 < colors.height ? y + 1 : 0;
+        }
+
+        const uint32_t showStart = micros();
+        hoop.showPixels(count);
+        showMicros = micros() - showStart;
+    }
+
+#if POV_PROFILING
+    /**
+     * @brief Print the column timing over Serial every POV_PROFILING_MICROS and start measuring again.
+     */
+    void report(uint32_t now) {
+        const uint32_t elapsed = now - reportStart;
+        if (elapsed < POV_PROFILING_MICROS) {
+            return;
+        }
+
+        const PovStats& stats = scheduler.getStats();
+        Serial.print("POV Columns/s: ");
+        Serial.print(static_cast<uint32_t>(stats.columns * 1000000ULL / elapsed));
+        Serial.print(", Turns/s: ");
+        Serial.print(static_cast<uint32_t>(stats.turns * 1000000ULL / elapsed));
+        Serial.print(", Missed: ");
+        Serial.print(stats.missedColumns);
+        Serial.print(", Delay Avg/Max (us): ");
+        Serial.print(stats.timedColumns ? stats.totalDelay / stats.timedColumns : 0);
+        Serial.print("/");
+        Serial.print(stats.maxDelay);
+        Serial.print(", Show (us): ");
+        Serial.println(showMicros);
+        scheduler.clearStats();
+        reportStart = now;
+    }
+#endif
+
+    uint16_t columnsPerTurn;      ///< Number of image columns shown per turn.
+    uint16_t pixels;              ///< Number of pixels showing each column, 0 for the column height.
+    RotationTracker tracker;      ///< Rotation of the hoop, integrated from the gyroscope.
+    PovScheduler scheduler;       ///< Column reached at each angle.
+    uint32_t showMicros = 0;      ///< Duration of the last partial show, in microseconds.
+    uint32_t reportStart = 0;     ///< Time in microseconds at which the statistics were last cleared.
+};
+
+#endif //OPENHOOP_POVEFFECT_H
@@ -12,6 +12,7 @@
 #define PULSEEFFECT_H
 
 #include "Effect.h"
+#include "../utils/Palette.h"
 #include <Arduino.h>
 
 /**
@@ -36,12 +37,17 @@ public:
      */
     void stop() override;
 
+    /**
+     * @brief Replace the ocean palette of the pulse effect.
+     */
+    void setPalette(const Palette256& newPalette) override;
+
 private:
     int pulseSpeed;          ///< Speed of the pulse effect.
     int pulseBrightness;     ///< Maximum brightness of the pulse.
     int pulseIncrement;      ///< Increment value to dynamically adjust brightness.
-    int currentColorIndex;   ///< Index to select the current color from the palette.
-    uint32_t colors[5]{};    ///< Array to store the color palette.
+    int currentColorIndex;   ///< Index to select the current fifth of the palette.
+    Palette256 palette;      ///< Palette the pulse runs through.
 };
 
 #endif //PULSEEFFECT_H
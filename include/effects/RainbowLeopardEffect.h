@@ -11,35 +11,21 @@
 #ifndef OPENHOOP_RAINBOWLEOPARDEFFECT_H
 #define OPENHOOP_RAINBOWLEOPARDEFFECT_H
 
-#include "Effect.h"
+#include "ImageScrollerEffect.h"
 #include "../images/LeopardPrintImage.h"
-#include "Arduino.h"
 
 /**
  * @brief Represents a rainbow leopard animal print LED effect.
  */
-class RainbowLeopardEffect : public Effect {
+class RainbowLeopardEffect : public ImageScrollerEffect<LeopardPrintImage> {
 public:
     RainbowLeopardEffect();
 
+protected:
     /**
-     * @brief Start the rainbow effect.
+     * @brief Fill the frame with the rainbow shown through the leopard print.
      */
-    void start() override;
-
-    /**
-     * @brief Update the rainbow effect.
-     */
-    void update() override;
-
-    /**
-     * @brief Stop the rainbow effect.
-     */
-    void stop() override;
-
-private:
-    int positionX = 0; ///< Horizontal position of the leopard pattern.
-    LeopardPrintImage leopardImage; ///< Instance of leopard print pattern image.
+    void renderBackground(RgbColor* frame, uint16_t pixels) override;
 };
 
 #endif //OPENHOOP_RAINBOWLEOPARDEFFECT_H
@@ -37,11 +37,11 @@ public:
     void stop() override;
 
 private:
-    float angle;  ///< Current angle of the effect.
-    float angularSpeed;  ///< Speed of rotation for the flag colors.
-    float colorOffset;  ///< Offset to adjust the color palette.
-    uint32_t color1, color2, color3;  ///< Colors representing the Rastafarian flag.
-    int numLeds;  ///< Number of LEDs in the hoop.
+    static constexpr uint16_t THIRD_TURN = 21845;  ///< A third of a turn as a 16-bit angle.
+    uint16_t angle;  ///< Current angle of the effect, a full turn spanning 65536.
+    uint16_t angularSpeed;  ///< Speed of rotation for the flag colors, as an angle per frame.
+    uint16_t colorOffset;  ///< Angle between two neighbouring pixels.
+    RgbColor color1, color2, color3;  ///< Colors representing the Rastafarian flag.
 };
 
 #endif //RASTAFARAIFLAGEFFECT_H
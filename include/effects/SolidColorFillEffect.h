@@ -13,6 +13,7 @@
 
 #include "Arduino.h"
 #include "Effect.h"
+#include "../utils/RgbColor.h"
 
 class SolidColorFillEffect : public Effect {
 public:
@@ -20,14 +21,14 @@ public:
      * @brief Constructor for SolidColorFillEffect.
      * @param color Solid color to fill the LEDs with.
      */
-    explicit SolidColorFillEffect(uint32_t color);
+    explicit SolidColorFillEffect(RgbColor color);
 
     void start() override;
     void update() override;
     void stop() override;
 
 private:
-    const uint32_t solidColor;  ///< Solid color for the fill effect.
+    const RgbColor solidColor;  ///< Solid color for the fill effect.
 };
 
 #endif //OPENHOOP_SOLIDCOLORFILLEFFECT_H
@@ -0,0 +1,61 @@
+/**
+ * @project OpenHoop
+ * @file SparksEffect.h
+ * @brief Header file for the SparksEffect class, representing an LED effect of sparks sliding around the hoop.
+ * @details Defines the SparksEffect class, which throws sparks from the top of the hoop and lets them slide down under
+ * the gravity measured by the accelerometer, leaving fading trails behind them.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_SPARKSEFFECT_H
+#define OPENHOOP_SPARKSEFFECT_H
+
+#include "Effect.h"
+#include "../utils/FastRandom.h"
+#include "../utils/Palette.h"
+#include "../utils/ParticleSystem.h"
+
+/**
+ * @brief Represents an LED effect of sparks sliding around the hoop.
+ */
+class SparksEffect : public Effect {
+public:
+    /**
+     * @brief Constructor for the SparksEffect class.
+     * @param seed Seed of the sparks, a fixed seed replaying the same sparks under the same tilt.
+     */
+    explicit SparksEffect(uint32_t seed = FastRandom::DEFAULT_SEED);
+
+    /**
+     * @brief Start the sparks effect.
+     */
+    void start() override;
+
+    /**
+     * @brief Update the sparks effect.
+     */
+    void update() override;
+
+    /**
+     * @brief Stop the sparks effect.
+     */
+    void stop() override;
+
+    /**
+     * @brief Replace the palette the sparks are colored from.
+     */
+    void setPalette(const Palette256& newPalette) override;
+
+private:
+    uint8_t emitRate;        ///< Sparks thrown per frame.
+    uint8_t decay;           ///< Life lost by each spark per frame.
+    int32_t gravityX;        ///< Last gravity read along the X axis, 4096 per g.
+    int32_t gravityY;        ///< Last gravity read along the Y axis, 4096 per g.
+    ParticleSystem sparks;   ///< Live sparks.
+    FastRandom sparkRandom;  ///< Generator of the sparks' speed, life and color.
+    Palette256 palette;      ///< Colors of the sparks.
+};
+
+#endif //OPENHOOP_SPARKSEFFECT_H
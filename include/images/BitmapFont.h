@@ -0,0 +1,35 @@
+/**
+ * @project OpenHoop
+ * @file BitmapFont.h
+ * @brief Header file for the BitmapFont class, a 5x7 pixel font of the printable ASCII characters.
+ * @details Defines the BitmapFont class, which gives the pixels of each character one column at a time from a table of
+ * 1-bit glyphs kept in flash, five bytes per character.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_BITMAPFONT_H
+#define OPENHOOP_BITMAPFONT_H
+
+#include <stdint.h>
+
+/**
+ * @brief 5x7 pixel font of the printable ASCII characters.
+ */
+class BitmapFont {
+public:
+    static constexpr int WIDTH = 5;    ///< Width of a glyph in pixels.
+    static constexpr int HEIGHT = 7;   ///< Height of a glyph in pixels.
+    static constexpr int ADVANCE = 6;  ///< Width of a character, its glyph followed by a blank column.
+
+    /**
+     * @brief Get a column of the glyph of a character.
+     * @param c Character, those outside the printable ASCII range showing as '?'.
+     * @param x Column of the glyph, from 0 to WIDTH - 1.
+     * @return Pixels of the column, the top pixel in bit 0.
+     */
+    static uint8_t glyphColumn(char c, int x);
+};
+
+#endif //OPENHOOP_BITMAPFONT_H
@@ -0,0 +1,53 @@
+/**
+ * @project OpenHoop
+ * @file CupcakePixels.h
+ * @brief Pixel table of the cupcake image.
+ * @details Defines the palette indices of CupcakeImage, shared by its source file, which encodes it into runs in flash,
+ * and the host benchmark of the image formats. The table is only read at compile time, so including it costs no memory.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_CUPCAKEPIXELS_H
+#define OPENHOOP_CUPCAKEPIXELS_H
+
+#include <stdint.h>
+
+namespace CupcakePixels {
+
+constexpr int WIDTH = 21;   ///< Width of the image.
+constexpr int HEIGHT = 22;  ///< Height of the image.
+constexpr uint8_t BITS = 4;  ///< Bits per pixel that hold every palette index when packed.
+
+/**
+ * @brief Palette index of each pixel, row by row, 0 being transparent.
+ */
+constexpr uint8_t PIXELS[1][HEIGHT][WIDTH] = {{
+        { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0},
+        { 0,  0,  0,  0,  0,  3,  3,  3,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0},
+        { 0,  0,  0,  0,  3,  4,  4,  4,  3,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0},
+        { 0,  0,  0,  3,  4,  2,  4,  4,  4,  3,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0},
+        { 0,  0,  0,  3,  4,  0,  4,  4,  4,  3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0},
+        { 0,  0,  0,  3,  4,  4,  4,  4,  4,  3,  1,  1,  1,  3,  3,  0,  0,  0,  0,  0,  0},
+        { 0,  0,  0,  0,  3,  4,  4,  4,  3,  1,  1,  5,  1,  1,  1,  3,  3,  0,  0,  0,  0},
+        { 0,  0,  0,  3,  1,  3,  3,  3,  1,  1,  1,  1,  1,  1,  6,  1,  1,  3,  0,  0,  0},
+        { 0,  0,  0,  3,  1,  1,  1,  7,  1,  1,  1,  1,  8,  1,  1,  1,  1,  3,  2,  0,  0},
+        { 0,  0,  3,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  7,  1,  1,  3,  0,  0},
+        { 0,  0,  3,  1,  1,  8,  1,  1,  1,  6,  1,  1,  1,  1,  1,  1,  1,  1,  3,  0,  0},
+        { 0,  3,  1,  1,  1,  1,  1,  9,  1,  1,  1,  1,  1,  5,  1,  1,  9,  1,  1,  3,  0},
+        { 0,  3,  1,  1,  1,  1,  1,  1,  1,  1,  8,  1,  1,  1,  1,  1,  1,  1,  1,  3,  0},
+        { 0,  3,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  3,  0},
+        { 0,  0,  3,  3,  3,  3,  1,  1,  1,  1,  3,  1,  1,  1,  1,  1,  1,  3,  3,  0,  0},
+        { 0,  0,  0,  3, 10, 10,  3,  1,  1,  3, 10,  3,  1,  1,  1,  1,  3,  3,  2,  0,  2},
+        { 0,  0,  0,  3, 10, 10, 10,  3,  3, 10, 10, 10,  3,  1,  1,  3, 10,  3,  0,  0,  2},
+        { 0,  0,  0,  0,  3, 10, 10, 10, 10, 10, 10, 10, 10,  3,  3, 10,  3,  0,  0,  0,  0},
+        { 0,  0,  0,  0,  3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  3,  0,  2,  0,  2},
+        { 0,  0,  0,  0,  3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  3,  0,  0,  0,  0},
+        { 0,  0,  0,  0,  0,  3, 10, 10, 10, 10, 10, 10, 10, 10, 10,  3,  2,  0,  2,  0,  2},
+        { 0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  3,  3,  3,  3,  3,  2,  0,  0,  0,  0,  0},
+}};
+
+}
+
+#endif //OPENHOOP_CUPCAKEPIXELS_H
@@ -2,7 +2,7 @@
  * @project OpenHoop
  * @file FlowerImage.h
  * @brief Header file for the FlowerImage class, representing an image of a flower.
- * @details Defines the FlowerImage class, a derived class from LedImage.
+ * @details Defines the FlowerImage class, a derived class from LedImage whose pixels are stored in flash.
  * @author github.com/angelcamelot
  * @date 2024-04-02
  * @license Open-source license.
@@ -22,12 +22,6 @@ public:
      * @brief Constructor for the FlowerImage class.
      */
     explicit FlowerImage(LedColor color);
-
-private:
-    /**
-     * @brief Set the colors for the pixel art.
-     */
-    void setColors(LedColor color);
 };
 
 #endif //OPENHOOP_FLOWERIMAGE_H
@@ -0,0 +1,49 @@
+/**
+ * @project OpenHoop
+ * @file FlowerPixels.h
+ * @brief Pixel table of the flower image.
+ * @details Defines the palette indices of FlowerImage, shared by its source file, which packs it into flash, and the
+ * host benchmark of the image formats. The table is only read at compile time, so including it costs no memory.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_FLOWERPIXELS_H
+#define OPENHOOP_FLOWERPIXELS_H
+
+#include <stdint.h>
+
+namespace FlowerPixels {
+
+constexpr int WIDTH = 12;   ///< Width of the image.
+constexpr int HEIGHT = 18;  ///< Height of the image.
+constexpr uint8_t BITS = 4;  ///< Bits per pixel that hold every palette index when packed.
+
+/**
+ * @brief Palette index of each pixel, row by row, 0 being transparent.
+ */
+constexpr uint8_t PIXELS[HEIGHT][WIDTH] = {
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 3, 3, 2, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 3, 3, 3, 2, 2, 0, 0, 0, 0, 0},
+        {0, 0, 2, 2, 2, 1, 1, 2, 2, 2, 0, 0},
+        {0, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 0},
+        {0, 2, 1, 1, 1, 2, 2, 1, 1, 1, 2, 0},
+        {0, 2, 2, 1, 2, 4, 4, 2, 1, 2, 2, 0},
+        {2, 1, 1, 2, 4, 4, 4, 4, 2, 1, 1, 2},
+        {2, 1, 1, 2, 4, 4, 4, 4, 2, 1, 1, 2},
+        {0, 2, 2, 1, 2, 4, 4, 2, 1, 2, 2, 0},
+        {0, 2, 1, 1, 1, 2, 2, 1, 1, 1, 2, 0},
+        {0, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 0},
+        {0, 0, 2, 2, 2, 1, 1, 2, 2, 2, 0, 0},
+        {0, 0, 0, 0, 0, 2, 2, 3, 3, 3, 2, 0},
+        {0, 0, 0, 0, 0, 0, 0, 2, 3, 3, 2, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
+
+}
+
+#endif //OPENHOOP_FLOWERPIXELS_H
@@ -1,8 +1,8 @@
 /**
  * @project OpenHoop
  * @file LedImage.h
- * @brief Header file for the LedImage class, an abstract base class representing an image composed of LEDs.
- * @details Defines the LedImage class and its methods for setting and getting pixel colors, as well as retrieving the width and height of the image.
+ * @brief Header file for the LedImage class, an image composed of LEDs and the base of the shipped images.
+ * @details Defines the LedImage class and its methods for getting pixel colors from a palette-indexed table, as well as retrieving the width and height of the image.
  * @author github.com/angelcamelot
  * @date 2024-03-17
  * @license Open-source license.
@@ -11,17 +11,21 @@
 #ifndef OPENHOOP_LEDIMAGE_H
 #define OPENHOOP_LEDIMAGE_H
 
+#include <stdint.h>
+#include <initializer_list>
+#include "../utils/RgbColor.h"
+
 /**
  * @brief Struct representing a color with red, green, blue, and alpha (transparency) components.
  */
 struct LedColor {
-    int red;        ///< Red component of the color.
-    int green;      ///< Green component of the color.
-    int blue;       ///< Blue component of the color.
-    int alpha;      ///< Alpha (transparency) component of the color (0 for fully transparent, 255 for opaque).
+    uint8_t red;    ///< Red component of the color.
+    uint8_t green;  ///< Green component of the color.
+    uint8_t blue;   ///< Blue component of the color.
+    uint8_t alpha;  ///< Alpha (transparency) component of the color (0 for fully transparent, 255 for opaque).
 
     // Default constructor initializes to a fully transparent color
-    LedColor() : red(0), green(0), blue(0), alpha(0) {}
+    constexpr LedColor() : red(0), green(0), blue(0), alpha(0) {}
 
     /**
      * @brief Constructor for LedColor struct.
@@ -30,38 +34,87 @@ struct LedColor {
      * @param b Blue component.
      * @param a Alpha (transparency) component (0 for fully transparent, 255 for opaque).
      */
-    LedColor(int r, int g, int b, int a = 255) : red(r), green(g), blue(b), alpha(a) {}
+    constexpr LedColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) : red(r), green(g), blue(b), alpha(a) {}
+
+    /**
+     * @brief Linear interpolation between two colors by frac/256, alpha included.
+     * @details Transparent image pixels are black, so the colors can be read as premultiplied by their alpha and blending
+     * a color into a transparent one fades it out.
+     */
+    static constexpr LedColor lerp8(LedColor a, LedColor b, uint8_t frac) {
+        return {::lerp8(a.red, b.red, frac), ::lerp8(a.green, b.green, frac), ::lerp8(a.blue, b.blue, frac),
+                ::lerp8(a.alpha, b.alpha, frac)};
+    }
 };
 
 /**
- * @brief Abstract base class representing an image composed of LEDs.
+ * @brief Palette indices of an image, packed into bytes at a fixed number of bits per pixel.
+ * @tparam W Width of the image.
+ * @tparam H Height of the image.
+ * @tparam BITS Bits per pixel: 1, 2, 4 or 8.
  */
-class LedImage {
-protected:
-    LedColor* pixels;       ///< Array to store pixel colors.
+template<int W, int H, uint8_t BITS>
+struct PackedPixels {
+    static_assert(BITS == 1 || BITS == 2 || BITS == 4 || BITS == 8, "Pixels must pack evenly into bytes");
+
+    uint8_t data[(W * H * BITS + 7) / 8];  ///< Indices column by column, the first pixel of each byte in its lowest bits.
+};
+
+/**
+ * @brief Pack a table of palette indices at compile time.
+ * @details The table is written row by row to read like the image, and packed column by column so scrolling effects,
+ * which show one column at a time along the hoop, read contiguous bits. Declare the result constexpr so only the packed
+ * bytes end up in flash. Indices wider than BITS are cut down to their lowest bits.
+ * @tparam BITS Bits per pixel: 1, 2, 4 or 8.
+ * @param pixels Palette index of each pixel, row by row.
+ * @return Packed indices.
+ */
+template<uint8_t BITS, int W, int H>
+constexpr PackedPixels<W, H, BITS> packPixels(const uint8_t (&pixels)[H][W]) {
+    PackedPixels<W, H, BITS> packed{};
+    for (int i = 0; i < W * H; i++) {
+        const int bit = i * BITS;
+        packed.data[bit / 8] |= static_cast<uint8_t>((pixels[i % H][i / H] & ((1 << BITS) - 1)) << (bit % 8));
+    }
+    return packed;
+}
+
+/**
+ * @brief Read-only view of one column of an image, top to bottom.
+ */
+struct LedColumn {
+    const LedColor* pixels;  ///< Colors of the column.
+    int height;              ///< Number of pixels in the column.
+};
 
+/**
+ * @brief Image composed of LEDs, used directly over a packed index table or as the base of other image formats.
+ * @details The image is a view of a table of palette indices kept in flash, packed at 1, 2, 4 or 8 bits per pixel, so
+ * creating one costs no pixel memory and no construction time. Only the palette, which derived images fill with their
+ * colors, lives in RAM, and recoloring an image only swaps palette entries.
+ */
+class LedImage {
 public:
+    static constexpr uint8_t MAX_COLORS = 16;  ///< Maximum number of palette entries, including the transparent one.
+    static constexpr int MAX_HEIGHT = 64;  ///< Maximum number of pixels returned per column.
+
     const int width;        ///< Width of the image.
     const int height;       ///< Height of the image.
+
     /**
      * @brief Constructor for the LedImage class.
      * @param w Width of the image.
      * @param h Height of the image.
+     * @param bits Bits per pixel of the packed indices: 1, 2, 4 or 8.
+     * @param packedIndices Palette indices as packed by packPixels. The table must outlive the image.
+     * @param colors Palette entries, up to MAX_COLORS. Indices without an entry are transparent.
      */
-    LedImage(int w, int h);
+    LedImage(int w, int h, uint8_t bits, const uint8_t* packedIndices, std::initializer_list<LedColor> colors);
 
     /**
      * @brief Destructor for the LedImage class.
      */
-    ~LedImage();
-
-    /**
-     * @brief Set the color of a pixel at a specific position.
-     * @param x X-coordinate of the pixel.
-     * @param y Y-coordinate of the pixel.
-     * @param color Color to set for the pixel.
-     */
-    void setPixel(int x, int y, const LedColor& color);
+    virtual ~LedImage() = default;
 
     /**
      * @brief Get the color of a pixel at a specific position.
@@ -78,6 +131,63 @@ public:
      * @return True if the coordinates are valid, false otherwise.
      */
     bool isValidIndex(int x, int y) const;
+
+    /**
+     * @brief Replace a palette entry, recoloring every pixel that uses it.
+     * @param index Palette index, entries past MAX_COLORS being ignored.
+     * @param color New color of the entry.
+     */
+    void setPaletteColor(uint8_t index, const LedColor& color);
+
+    /**
+     * @brief Get the colors of a column.
+     * @details The column is decoded into a buffer owned by the image, valid until the next call.
+     * @param x X-coordinate of the column. Columns out of bounds are fully transparent.
+     * @return Colors of the column, up to MAX_HEIGHT pixels.
+     */
+    LedColumn column(int x);
+
+protected:
+    /**
+     * @brief Constructor for images stored in another format than packed indices.
+     * @details Such images must override both decodePixel and decodeColumn.
+     * @param w Width of the image.
+     * @param h Height of the image.
+     * @param colors Palette entries, up to MAX_COLORS. Indices without an entry are transparent.
+     */
+    LedImage(int w, int h, std::initializer_list<LedColor> colors);
+
+    /**
+     * @brief Get the color of a palette entry.
+     * @param index Palette index, wrapped to MAX_COLORS.
+     */
+    LedColor paletteColor(uint8_t index) const {
+        return palette[index % MAX_COLORS];
+    }
+
+    /**
+     * @brief Decode the color of a pixel.
+     * @details Reads the packed palette indices. Images stored in other formats override it.
+     * @param x X-coordinate of the pixel, within bounds.
+     * @param y Y-coordinate of the pixel, within bounds.
+     * @return Color of the pixel.
+     */
+    virtual LedColor decodePixel(int x, int y) const;
+
+    /**
+     * @brief Decode the colors of a column.
+     * @details Reads the packed palette indices. Images stored in other formats override it.
+     * @param x X-coordinate of the column, within bounds.
+     * @param pixels Receives the colors of the first count pixels of the column.
+     * @param count Number of pixels to decode, at most the height of the image.
+     */
+    virtual void decodeColumn(int x, LedColor* pixels, int count) const;
+
+private:
+    const uint8_t* indices;             ///< Palette indices packed by packPixels.
+    uint8_t bitsPerPixel;               ///< Bits per packed index.
+    LedColor palette[MAX_COLORS];       ///< Colors of the image, indexed by the pixels.
+    LedColor columnBuffer[MAX_HEIGHT];  ///< Colors of the last column returned.
 };
 
 #endif // OPENHOOP_LEDIMAGE_H
@@ -2,7 +2,7 @@
  * @project OpenHoop
  * @file LeopardPrintImage.h
  * @brief Header file for the LeopardPrintImage class, representing an image of a Leopard print pattern.
- * @details Defines the LeopardPrintImage class, a derived class from LedImage.
+ * @details Defines the LeopardPrintImage class, a derived class from LedImage whose pixels are stored in flash.
  * @author github.com/angelcamelot
  * @date 2024-04-02
  * @license Open-source license.
@@ -23,9 +23,10 @@ public:
      */
     explicit LeopardPrintImage(LedColor primary_color, LedColor secondary_color);
 
-private:
     /**
-     * @brief Set the colors for the leopard print pattern.
+     * @brief Recolor the leopard print pattern.
+     * @param primary_color The darker color of the leopard spots.
+     * @param secondary_color The lighter color of the leopard spots.
      */
     void setPatternColors(LedColor primary_color, LedColor secondary_color);
 };
@@ -0,0 +1,61 @@
+/**
+ * @project OpenHoop
+ * @file LeopardPrintPixels.h
+ * @brief Pixel table of the leopard print image.
+ * @details Defines the palette indices of LeopardPrintImage, shared by its source file, which packs it into flash, and
+ * the host benchmark of the image formats. The table is only read at compile time, so including it costs no memory.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_LEOPARDPRINTPIXELS_H
+#define OPENHOOP_LEOPARDPRINTPIXELS_H
+
+#include <stdint.h>
+
+namespace LeopardPrintPixels {
+
+constexpr int WIDTH = 30;   ///< Width of the image.
+constexpr int HEIGHT = 30;  ///< Height of the image.
+constexpr uint8_t BITS = 2;  ///< Bits per pixel that hold every palette index when packed.
+
+/**
+ * @brief Palette index of each pixel, row by row, 0 being transparent.
+ */
+constexpr uint8_t PIXELS[HEIGHT][WIDTH] = {
+        {2, 1, 0, 0, 1, 1, 0, 2, 2, 1, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1},
+        {2, 1, 0, 1, 2, 2, 0, 0, 1, 0, 0, 0, 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0},
+        {1, 0, 0, 1, 2, 2, 1, 0, 1, 2, 1, 0, 1, 2, 2, 1, 2, 2, 1, 0, 1, 1, 2, 2, 1, 0, 0, 1, 1, 2},
+        {1, 0, 0, 0, 1, 2, 1, 0, 2, 2, 2, 1, 1, 2, 2, 1, 2, 2, 1, 2, 2, 1, 2, 2, 2, 0, 1, 2, 2, 2},
+        {2, 1, 0, 0, 0, 1, 0, 0, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 1, 2, 2, 1, 1, 2, 2, 1, 2, 2, 2, 2},
+        {2, 2, 2, 1, 0, 0, 0, 0, 1, 1, 2, 1, 1, 0, 1, 1, 2, 1, 0, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 1},
+        {1, 2, 2, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0},
+        {1, 2, 1, 0, 0, 1, 2, 2, 2, 0, 0, 1, 2, 2, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 0, 0, 2, 1, 1, 1, 1, 0, 0, 2, 2, 2, 1, 2, 2, 0, 0, 1, 2, 2, 0, 0, 0, 0, 1, 1, 1, 0},
+        {0, 0, 0, 1, 2, 2, 1, 2, 1, 0, 0, 2, 2, 1, 2, 2, 2, 1, 0, 0, 1, 1, 0, 1, 2, 2, 2, 2, 2, 0},
+        {0, 0, 0, 2, 2, 1, 2, 2, 2, 0, 0, 1, 1, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 2, 2, 2, 1, 2, 2, 0},
+        {0, 0, 0, 1, 1, 0, 2, 2, 1, 0, 0, 0, 0, 0, 2, 1, 0, 0, 1, 2, 2, 0, 0, 0, 1, 1, 1, 2, 2, 0},
+        {2, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 2, 2, 2, 2, 1},
+        {2, 1, 1, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 1, 2, 2, 1, 1, 1, 2, 0, 0, 2, 2, 2, 2, 1},
+        {2, 0, 1, 2, 2, 1, 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 1, 2, 2, 1, 1, 2, 2, 2, 0, 0, 0, 0, 0, 0},
+        {1, 0, 1, 2, 2, 1, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 1, 1},
+        {0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 2, 2},
+        {0, 0, 1, 1, 0, 0, 1, 2, 2, 0, 0, 0, 0, 2, 2, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 2, 2},
+        {0, 1, 2, 2, 1, 0, 1, 2, 2, 2, 0, 0, 0, 2, 2, 1, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 0, 1, 2},
+        {1, 2, 2, 2, 1, 0, 0, 2, 2, 2, 0, 0, 0, 1, 1, 2, 2, 1, 0, 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0},
+        {2, 2, 2, 1, 0, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 1, 2, 2, 1, 1, 2, 1, 1, 0, 0},
+        {2, 2, 2, 1, 0, 0, 2, 2, 2, 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 1, 2, 2, 2, 1, 1, 2, 2, 1, 0},
+        {1, 2, 2, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 2, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 1, 2, 2, 2, 0},
+        {0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 2, 2, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0},
+        {0, 0, 0, 2, 2, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 2, 2, 2, 1, 0, 1, 2, 2, 2, 1, 0, 0, 0, 1, 1, 2, 2, 1, 0, 0, 1, 1, 1, 0, 0, 1, 2, 2},
+        {0, 1, 2, 2, 2, 0, 0, 1, 2, 2, 2, 0, 0, 1, 2, 1, 1, 2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 2, 2, 2},
+        {0, 1, 2, 2, 1, 0, 0, 1, 1, 2, 1, 0, 0, 2, 2, 1, 2, 2, 1, 0, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2},
+        {0, 1, 2, 2, 1, 0, 1, 2, 2, 2, 2, 0, 0, 1, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 1, 1},
+        {0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 1, 0, 0, 1, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 1, 0, 0, 1},
+};
+
+}
+
+#endif //OPENHOOP_LEOPARDPRINTPIXELS_H
@@ -0,0 +1,47 @@
+/**
+ * @project OpenHoop
+ * @file MushroomPixels.h
+ * @brief Pixel table of the mushroom image.
+ * @details Defines the palette indices of MushroomImage, shared by its source file, which packs it into flash, and the
+ * host benchmark of the image formats. The table is only read at compile time, so including it costs no memory.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_MUSHROOMPIXELS_H
+#define OPENHOOP_MUSHROOMPIXELS_H
+
+#include <stdint.h>
+
+namespace MushroomPixels {
+
+constexpr int WIDTH = 13;   ///< Width of the image.
+constexpr int HEIGHT = 16;  ///< Height of the image.
+constexpr uint8_t BITS = 2;  ///< Bits per pixel that hold every palette index when packed.
+
+/**
+ * @brief Palette index of each pixel, row by row, 0 being transparent.
+ */
+constexpr uint8_t PIXELS[HEIGHT][WIDTH] = {
+        {0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0},
+        {0, 0, 0, 2, 2, 1, 1, 1, 1, 0, 0, 2, 2},
+        {0, 0, 2, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0},
+        {0, 2, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0},
+        {0, 2, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0},
+        {2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1},
+        {2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0},
+        {2, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0},
+        {2, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0},
+        {2, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0},
+        {2, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1},
+        {0, 2, 2, 2, 3, 3, 2, 3, 3, 2, 3, 3, 2},
+        {0, 0, 2, 3, 3, 3, 2, 3, 3, 2, 3, 3, 3},
+        {0, 0, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+        {0, 0, 0, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2},
+        {0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0},
+};
+
+}
+
+#endif //OPENHOOP_MUSHROOMPIXELS_H
@@ -0,0 +1,185 @@
+/**
+ * @project OpenHoop
+ * @file RleImage.h
+ * @brief Header file for the RleImage class, an image or sprite animation stored as run-length encoded columns.
+ * @details Defines the run-length encoded image format, the compile-time encoder that builds it from tables of palette
+ * indices, and the RleImage class that decodes any column of any frame straight from flash. Each column is a sequence
+ * of runs, and a column left unchanged from the previous frame points at the runs of that frame instead of repeating
+ * them, so animations only store the columns that change.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_RLEIMAGE_H
+#define OPENHOOP_RLEIMAGE_H
+
+#include "LedImage.h"
+
+/**
+ * @brief Run-length encoded columns of an image or animation.
+ * @details Each run is a byte holding the palette index in its low 4 bits and the run length minus one in its high 4
+ * bits, so a run covers 1 to 16 pixels. Runs never continue into the next column.
+ * @tparam W Width of the image.
+ * @tparam H Height of the image.
+ * @tparam F Number of frames.
+ * @tparam RUNS Number of runs stored.
+ */
+template<int W, int H, int F, int RUNS>
+struct RlePixels {
+    static_assert(RUNS <= 0xFFFF, "Run offsets must fit in 16 bits");
+
+    uint16_t offsets[F * W];  ///< Index of the first run of each column, frame by frame.
+    uint8_t runs[RUNS > 0 ? RUNS : 1];  ///< Runs of the columns that differ from the previous frame.
+};
+
+namespace rle {
+
+/**
+ * @brief Get the length of the run starting at a pixel, at most 16.
+ */
+template<int F, int H, int W>
+constexpr int runLength(const uint8_t (&frames)[F][H][W], int f, int x, int y) {
+    int length = 1;
+    while (length < 16 && y + length < H && (frames[f][y + length][x] & 0x0F) == (frames[f][y][x] & 0x0F)) {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * @brief Count the runs of a column.
+ */
+template<int F, int H, int W>
+constexpr int columnRuns(const uint8_t (&frames)[F][H][W], int f, int x) {
+    int runs = 0;
+    for (int y = 0; y < H; y += runLength(frames, f, x, y)) {
+        runs++;
+    }
+    return runs;
+}
+
+/**
+ * @brief Check whether a column is the same as in the previous frame.
+ */
+template<int F, int H, int W>
+constexpr bool sameAsPrevious(const uint8_t (&frames)[F][H][W], int f, int x) {
+    if (f == 0) {
+        return false;
+    }
+    for (int y = 0; y < H; y++) {
+        if ((frames[f][y][x] & 0x0F) != (frames[f - 1][y][x] & 0x0F)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+/**
+ * @brief Count the runs needed to encode a table of frames, the size to pass to encodeRuns.
+ * @param frames Palette index of each pixel, frame by frame and row by row.
+ * @return Number of runs.
+ */
+template<int F, int H, int W>
+constexpr int countRuns(const uint8_t (&frames)[F][H][W]) {
+    int runs = 0;
+    for (int f = 0; f < F; f++) {
+        for (int x = 0; x < W; x++) {
+            if (!rle::sameAsPrevious(frames, f, x)) {
+                runs += rle::columnRuns(frames, f, x);
+            }
+        }
+    }
+    return runs;
+}
+
+/**
+ * @brief Run-length encode a table of frames at compile time.
+ * @details Tables are written row by row to read like the image, and encoded column by column. Declare the result
+ * constexpr so only the runs and offsets end up in flash. Indices wider than 4 bits are cut down to their lowest bits.
+ * @tparam RUNS Number of runs, as counted by countRuns.
+ * @param frames Palette index of each pixel, frame by frame and row by row.
+ * @return Encoded columns.
+ */
+template<int RUNS, int F, int H, int W>
+constexpr RlePixels<W, H, F, RUNS> encodeRuns(const uint8_t (&frames)[F][H][W]) {
+    RlePixels<W, H, F, RUNS> encoded{};
+    int next = 0;
+    for (int f = 0; f < F; f++) {
+        for (int x = 0; x < W; x++) {
+            if (rle::sameAsPrevious(frames, f, x)) {
+                encoded.offsets[f * W + x] = encoded.offsets[(f - 1) * W + x];
+                continue;
+            }
+            encoded.offsets[f * W + x] = static_cast<uint16_t>(next);
+            for (int y = 0; y < H;) {
+                const int length = rle::runLength(frames, f, x, y);
+                encoded.runs[next++] = static_cast<uint8_t>((length - 1) << 4 | (frames[f][y][x] & 0x0F));
+                y += length;
+            }
+        }
+    }
+    return encoded;
+}
+
+/**
+ * @brief Image or sprite animation stored as run-length encoded columns in flash.
+ * @details Columns are decoded run by run into the column buffer of the image, so neither the image nor the animation
+ * is ever expanded in RAM. Frames share the palette of the image.
+ */
+class RleImage : public LedImage {
+public:
+    /**
+     * @brief Select the frame returned by getPixel and column.
+     * @param frame Index of the frame, wrapped to the number of frames.
+     */
+    void setFrame(uint16_t frame);
+
+    /**
+     * @brief Get the index of the selected frame.
+     */
+    uint16_t getFrame() const;
+
+    /**
+     * @brief Get the number of frames.
+     */
+    uint16_t getFrameCount() const;
+
+protected:
+    /**
+     * @brief Constructor for the RleImage class.
+     * @param w Width of the image.
+     * @param h Height of the image.
+     * @param frames Number of frames.
+     * @param columnOffsets Offsets of the columns, as encoded by encodeRuns. The table must outlive the image.
+     * @param columnRuns Runs of the columns, as encoded by encodeRuns. The table must outlive the image.
+     * @param colors Palette entries, up to MAX_COLORS. Indices without an entry are transparent.
+     */
+    RleImage(int w, int h, uint16_t frames, const uint16_t* columnOffsets, const uint8_t* columnRuns,
+             std::initializer_list<LedColor> colors);
+
+    /**
+     * @brief Decode the color of a pixel by walking the runs of its column.
+     */
+    LedColor decodePixel(int x, int y) const override;
+
+    /**
+     * @brief Decode the colors of a column run by run.
+     */
+    void decodeColumn(int x, LedColor* pixels, int count) const override;
+
+private:
+    /**
+     * @brief Get the first run of a column of the selected frame.
+     */
+    const uint8_t* firstRun(int x) const;
+
+    const uint16_t* offsets;  ///< Index of the first run of each column, frame by frame.
+    const uint8_t* runs;      ///< Runs of the columns.
+    uint16_t frameCount;      ///< Number of frames.
+    uint16_t currentFrame = 0;  ///< Frame returned by getPixel and column.
+};
+
+#endif //OPENHOOP_RLEIMAGE_H
@@ -0,0 +1,62 @@
+/**
+ * @project OpenHoop
+ * @file TextImage.h
+ * @brief Header file for the TextImage class, an image of a line of text drawn with the bitmap font.
+ * @details Defines the TextImage class, a derived class from LedImage that keeps the characters of the text instead of
+ * pixels and draws each column from the font when it is asked for, so a message costs one byte per character however
+ * long it is.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_TEXTIMAGE_H
+#define OPENHOOP_TEXTIMAGE_H
+
+#include "LedImage.h"
+#include "BitmapFont.h"
+#include "../Config.h"
+
+/**
+ * @brief Represents a line of text for the Hula Hoop LED display, one character every BitmapFont::ADVANCE columns.
+ */
+class TextImage : public LedImage {
+public:
+    /**
+     * @brief Constructor for the TextImage class.
+     * @param text Text to draw, cut at TEXT_MAX_LENGTH characters. Empty texts draw a single space.
+     * @param color Color of the characters, drawn over a transparent background.
+     */
+    TextImage(const char* text, LedColor color);
+
+    /**
+     * @brief Get the number of characters of the text.
+     */
+    int getLength() const;
+
+protected:
+    /**
+     * @brief Decode the color of a pixel from the glyph of its character.
+     */
+    LedColor decodePixel(int x, int y) const override;
+
+    /**
+     * @brief Decode the colors of a column from the glyph of its character.
+     */
+    void decodeColumn(int x, LedColor* pixels, int count) const override;
+
+private:
+    /**
+     * @brief Get the number of characters drawn for a text.
+     */
+    static int measure(const char* text);
+
+    /**
+     * @brief Get the pixels of a column, the top pixel in bit 0.
+     */
+    uint8_t columnBits(int x) const;
+
+    char characters[TEXT_MAX_LENGTH];  ///< Characters of the text, not null-terminated.
+};
+
+#endif //OPENHOOP_TEXTIMAGE_H
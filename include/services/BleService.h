@@ -41,6 +41,9 @@ public:
     BLEByteCharacteristic effectCharacteristic;  ///< Effect characteristic for BLE.
     BLEStringCharacteristic solidColorCharacteristic;  ///< Solid color characteristic for BLE.
     BLEByteCharacteristic energySavingModeCharacteristic;  ///< Energy-saving mode characteristic.
+    BLECharacteristic paletteCharacteristic;  ///< Palette characteristic, a list of (position, red, green, blue) stops.
+    BLEUnsignedIntCharacteristic automatonRuleCharacteristic;  ///< Cellular automaton rule code characteristic.
+    BLEStringCharacteristic textCharacteristic;  ///< Text message characteristic for BLE.
 
 private:
     BLEService hulaHoopService;  ///< Hula Hoop service for BLE.
@@ -12,7 +12,11 @@
 #define OPENHOOP_EFFECTSERVICE_H
 
 #include <Arduino.h>
+#include <map>
 #include "../effects/Effect.h"
+#include "../utils/HulaHoopNeoPixel.h"
+#include "../utils/Palette.h"
+#include "../utils/RotationTracker.h"
 
 enum class EffectType {
     NO_EFFECT,
@@ -23,10 +27,28 @@ enum class EffectType {
     FIRE,
     LEOPARDRAINBOW,
     MUSHROOM,
+    AUTOMATON,
+    SPARKS,
+    FLUID,
+    POV,
+    TEXT,
+    POV_TEXT,
     PULSE = 98,
     SPECTRUM = 99,
 };
 
+/**
+ * @brief Rendering options applied to the hoop while an effect is running.
+ */
+struct EffectOptions {
+    SymmetryMode symmetry = SymmetryMode::NONE;  ///< Symmetry used to replicate the rendered pixels.
+    uint8_t folds = 1;  ///< Number of copies of the rendered pixels around the hoop.
+    uint16_t resolution = 0;  ///< Number of pixels rendered per fold, 0 renders at full resolution.
+    UpsampleMode upsample = UpsampleMode::LINEAR;  ///< Interpolation used to upsample the rendered pixels.
+    uint8_t simulationRate = 0;  ///< Effect updates per second, interpolated up to the refresh rate; 0 updates every frame.
+    bool stabilized = false;  ///< Whether the rendered pixels stay still in the world while the hoop spins.
+};
+
 /**
  * @class EffectService
  * @brief Class responsible for managing LED effects.
@@ -34,18 +56,60 @@ enum class EffectType {
 class EffectService {
 private:
  std::unique_ptr<Effect> currentEffect;  ///< Pointer to the current active effect.
+ std::map<EffectType, EffectOptions> effectOptions;  ///< Rendering options of each effect.
+ uint32_t simulationPeriod = 0;  ///< Time in microseconds between two effect updates, 0 updates every frame.
+ uint32_t lastSimulation = 0;  ///< Time in microseconds of the last effect update.
+ uint32_t renderMicros = 0;  ///< Accumulated time spent rendering frames, excluding show().
+ uint16_t renderedFrames = 0;  ///< Number of frames accumulated in renderMicros.
+ Palette256 customPalette;  ///< Palette uploaded over BLE.
+ bool hasCustomPalette = false;  ///< Whether effects render with the uploaded palette instead of their own.
+ uint32_t automatonRule = 30;  ///< Rule code of the cellular automaton effect.
+ String message = "OpenHoop";  ///< Text shown by the text effects.
+ bool stabilized = false;  ///< Whether the hoop rotation is cancelled for the current effect.
+ RotationTracker rotation;  ///< Angle the hoop turned since the current effect started, from the gyroscope.
+
+ /**
+  * @brief Read the gyroscope and turn the composed frame back by the angle the hoop turned.
+  */
+ void updateRotation();
+
+ /**
+  * @brief Accumulate and periodically report the render time of the current effect.
+  * @param updateStart Time in microseconds at which the effect update started.
+  */
+ void profileFrame(uint32_t updateStart);
 
 public:
+ /**
+  * @brief Constructor for the EffectService class, setting the default rendering options.
+  */
+ EffectService();
+
  /**
   * @brief Set a new effect.
   * @param newEffect Pointer to the new effect to be set.
+  * @param options Rendering options to apply while the effect is running.
   */
- void setEffect(std::unique_ptr<Effect> newEffect);
+ void setEffect(std::unique_ptr<Effect> newEffect, const EffectOptions& options = EffectOptions());
 
  /**
   * @brief Update the current effect.
   */
- void update() const;
+ void update();
+
+ /**
+  * @brief Set the rendering options used the next time an effect is dispatched.
+  * @param type Effect the options apply to.
+  * @param options Rendering options of the effect.
+  */
+ void setEffectOptions(EffectType type, const EffectOptions& options);
+
+ /**
+  * @brief Get the rendering options of an effect.
+  * @param type Effect to look up.
+  * @return Rendering options of the effect, or the defaults if none were set.
+  */
+ EffectOptions getEffectOptions(EffectType type) const;
 
  /**
   * @brief Dispatch BLE command for changing the LED effect.
@@ -59,6 +123,25 @@ public:
   */
  void dispatchSolidColorCommand(const String& colorString);
 
+ /**
+  * @brief Dispatch BLE command for uploading a palette.
+  * @param data Gradient stops received through BLE command, four bytes each: position, red, green and blue.
+  * @param length Number of bytes received, an empty command restoring the palettes of the effects.
+  */
+ void dispatchPaletteCommand(const uint8_t* data, int length);
+
+ /**
+  * @brief Dispatch BLE command for running a cellular automaton rule.
+  * @param ruleCode Rule code received through BLE command, as decoded by AutomatonRule::fromCode.
+  */
+ void dispatchAutomatonCommand(uint32_t ruleCode);
+
+ /**
+  * @brief Dispatch BLE command for showing a text message.
+  * @param text Text received through BLE command, up to TEXT_MAX_LENGTH characters.
+  */
+ void dispatchTextCommand(const String& text);
+
  /**
   * @brief Destructor for the EffectService class.
   */
@@ -0,0 +1,135 @@
+/**
+ * @project OpenHoop
+ * @file CellularAutomaton.h
+ * @brief Header file for the CellularAutomaton class, a one-dimensional cellular automaton around the hoop.
+ * @details Defines the automaton rules and the CellularAutomaton class, which stores its cells as bits packed into
+ * 32-bit words on a ring and steps whole words at a time with shifts and logic operations. It runs Wolfram's
+ * elementary rules, life-like rules over the four nearest neighbours, and their multi-state "generations" variant
+ * where dead cells keep decaying for a few steps before they can be born again.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_CELLULARAUTOMATON_H
+#define OPENHOOP_CELLULARAUTOMATON_H
+
+#include <stdint.h>
+#include "../Config.h"
+#include "FastRandom.h"
+
+/**
+ * @brief Rule of a cellular automaton.
+ */
+struct AutomatonRule {
+    uint8_t wolfram = 30;  ///< Wolfram rule number, used when states is 0.
+    uint8_t birth = 0;     ///< Bit k set when a dead cell with k live neighbours out of 4 is born.
+    uint8_t survive = 0;   ///< Bit k set when a live cell with k live neighbours out of 4 survives.
+    uint8_t states = 0;    ///< 0 for an elementary rule, 2 for a life-like rule, up to 9 for a generations rule.
+
+    /**
+     * @brief Decode a rule from its 32-bit code.
+     * @details The code holds the Wolfram rule number in its lowest byte, then the birth mask, the survive mask and the
+     * number of states, so codes below 256 are plain elementary rule numbers.
+     * @param code Rule code.
+     * @return Decoded rule, with the number of states clamped to a supported value.
+     */
+    static AutomatonRule fromCode(uint32_t code);
+
+    /**
+     * @brief Check whether a code describes a rule.
+     * @details Rules that can never bring a cell to life are rejected, as they die out at once and reseed every frame:
+     * Wolfram rule 0, and codes from 256 up with an empty birth mask. Codes from 256 up must also give a number of
+     * states from 1 to MAX_STATES; a code with 0 states would silently run the Wolfram rule of its lowest byte.
+     * @param code Rule code.
+     * @return True if the code is a Wolfram rule number other than 0, or has births and a supported number of states.
+     */
+    static bool isValidCode(uint32_t code);
+};
+
+/**
+ * @brief One-dimensional cellular automaton on a ring of bit-packed cells.
+ */
+class CellularAutomaton {
+public:
+    static constexpr uint16_t MAX_CELLS = NUM_LEDS;  ///< Maximum number of cells.
+    static constexpr uint8_t MAX_STATES = 9;  ///< Maximum number of states of a generations rule.
+
+    /**
+     * @brief Clear the automaton and set its size and rule.
+     * @param cellCount Number of cells on the ring, up to MAX_CELLS.
+     * @param newRule Rule to step with.
+     */
+    void reset(uint16_t cellCount, const AutomatonRule& newRule);
+
+    /**
+     * @brief Bring the cell at the middle of the ring to life.
+     */
+    void seedCenter();
+
+    /**
+     * @brief Bring random cells to life.
+     * @param random Generator drawing the cells.
+     * @param density Chance out of 256 of each cell being alive.
+     */
+    void seedRandom(FastRandom& random, uint8_t density);
+
+    /**
+     * @brief Advance the automaton by a generation.
+     */
+    void step();
+
+    /**
+     * @brief Get the state of a cell.
+     * @param cell Index of the cell.
+     * @return 0 for a dead cell, 1 for a live one, and 2 or more for a cell decaying under a generations rule.
+     */
+    uint8_t getState(uint16_t cell) const;
+
+    /**
+     * @brief Check whether every cell is dead.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Get the number of generations stepped since the last reset.
+     */
+    uint32_t getGeneration() const;
+
+    /**
+     * @brief Get the rule the automaton steps with.
+     */
+    const AutomatonRule& getRule() const;
+
+private:
+    static constexpr uint8_t MAX_WORDS = (MAX_CELLS + 31) / 32;  ///< Words needed to hold the largest ring.
+    static constexpr uint8_t AGE_PLANES = 3;  ///< Bit planes holding the decay age of the cells.
+
+    /**
+     * @brief Rotate the ring by one cell, so each cell receives the state of one of its neighbours.
+     * @param source Cells to rotate.
+     * @param destination Rotated cells.
+     * @param fromNext Whether cells receive their next neighbour's state rather than their previous one's.
+     */
+    void rotate(const uint32_t* source, uint32_t* destination, bool fromNext) const;
+
+    /**
+     * @brief Step an elementary rule over the three-cell neighbourhoods.
+     */
+    void stepElementary();
+
+    /**
+     * @brief Step a life-like or generations rule over the four nearest neighbours.
+     */
+    void stepGenerations();
+
+    uint16_t size = 0;  ///< Number of cells on the ring.
+    uint8_t words = 0;  ///< Number of words holding the ring.
+    uint32_t lastMask = 0;  ///< Bits of the last word that hold cells.
+    uint32_t generation = 0;  ///< Generations stepped since the last reset.
+    AutomatonRule rule;  ///< Rule the automaton steps with.
+    uint32_t alive[MAX_WORDS] = {};  ///< Live cells.
+    uint32_t age[AGE_PLANES][MAX_WORDS] = {};  ///< Bit planes of the decay age of each cell, 0 unless decaying.
+};
+
+#endif //OPENHOOP_CELLULARAUTOMATON_H
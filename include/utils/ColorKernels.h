@@ -0,0 +1,87 @@
+/**
+ * @project OpenHoop
+ * @file ColorKernels.h
+ * @brief Header file for the ColorKernels class, containing whole-frame color operations.
+ * @details Defines static methods that fade, scale, add, subtract and blend frames of packed colors. Each method works
+ * on four channels at a time inside a 32-bit word, using the Cortex-M4 SIMD instructions when they are available and
+ * portable mask-and-multiply code otherwise.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_COLORKERNELS_H
+#define OPENHOOP_COLORKERNELS_H
+
+#include <stdint.h>
+#include "RgbColor.h"
+
+/**
+ * @brief Whole-frame color operations working on several channels per 32-bit word.
+ */
+class ColorKernels {
+public:
+    /**
+     * @brief Fade colors towards black.
+     * @param pixels Colors to fade in place.
+     * @param count Number of colors.
+     * @param amount How much to fade, from 0 (unchanged) to 255 (black).
+     */
+    static void fadeToBlack(RgbColor* pixels, uint16_t count, uint8_t amount);
+
+    /**
+     * @brief Scale colors by a global brightness.
+     * @param pixels Colors to scale in place.
+     * @param count Number of colors.
+     * @param scale Brightness from 0 (black) to 255 (unchanged).
+     */
+    static void scale(RgbColor* pixels, uint16_t count, uint8_t scale);
+
+    /**
+     * @brief Add colors, saturating each channel at 255.
+     * @param destination Colors to add to.
+     * @param source Colors to add.
+     * @param count Number of colors.
+     */
+    static void add(RgbColor* destination, const RgbColor* source, uint16_t count);
+
+    /**
+     * @brief Subtract colors, saturating each channel at 0.
+     * @param destination Colors to subtract from.
+     * @param source Colors to subtract.
+     * @param count Number of colors.
+     */
+    static void subtract(RgbColor* destination, const RgbColor* source, uint16_t count);
+
+    /**
+     * @brief Blend colors over others.
+     * @param destination Colors to blend over.
+     * @param source Colors to blend.
+     * @param count Number of colors.
+     * @param alpha Opacity of the source colors, from 0 (destination unchanged) to 255 (source copied).
+     */
+    static void blend(RgbColor* destination, const RgbColor* source, uint16_t count, uint8_t alpha);
+
+private:
+    /**
+     * @brief Scale the four channels of a word by weight/256.
+     */
+    static uint32_t scaleWord(uint32_t word, uint32_t weight);
+
+    /**
+     * @brief Add the four channels of two words, saturating at 255.
+     */
+    static uint32_t addWord(uint32_t a, uint32_t b);
+
+    /**
+     * @brief Subtract the four channels of two words, saturating at 0.
+     */
+    static uint32_t subtractWord(uint32_t a, uint32_t b);
+
+    /**
+     * @brief Blend the four channels of two words, weighting the second one by weight/256.
+     */
+    static uint32_t blendWord(uint32_t a, uint32_t b, uint32_t weight);
+};
+
+#endif //OPENHOOP_COLORKERNELS_H
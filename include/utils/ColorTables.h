@@ -0,0 +1,76 @@
+/**
+ * @project OpenHoop
+ * @file ColorTables.h
+ * @brief Header file for the ColorTables class, containing precomputed color lookup tables.
+ * @details Defines static methods that look up fully saturated hue and color wheel colors in 256-entry tables generated
+ * at compile time and stored in flash, along with batch methods that fill a whole frame with a gradient of them.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_COLORTABLES_H
+#define OPENHOOP_COLORTABLES_H
+
+#include <stdint.h>
+#include "RgbColor.h"
+
+/**
+ * @brief 256 colors indexed by an 8-bit position.
+ */
+struct ColorTable {
+    RgbColor colors[256];  ///< Color for each position.
+};
+
+/**
+ * @brief Precomputed hue and color wheel lookups.
+ */
+class ColorTables {
+public:
+    /**
+     * @brief Get a fully saturated, full value hue.
+     * @param hue Hue, a full turn of the HSV color circle spanning 0 to 255.
+     * @return Color of the hue.
+     */
+    static RgbColor hue(uint8_t hue) {
+        return HUE.colors[hue];
+    }
+
+    /**
+     * @brief Get a color from the color wheel, going from red to blue to green and back to red.
+     * @param position Position in the color wheel.
+     * @return Color at the position.
+     */
+    static RgbColor wheel(uint8_t position) {
+        return WHEEL.colors[position];
+    }
+
+    /**
+     * @brief Fill colors with a hue gradient.
+     * @param pixels Colors to fill.
+     * @param count Number of colors.
+     * @param startHue Hue of the first color, in 8.8 fixed point.
+     * @param delta Hue step between two colors, in 8.8 fixed point.
+     */
+    static void fillHueGradient(RgbColor* pixels, uint16_t count, uint16_t startHue, uint16_t delta);
+
+    /**
+     * @brief Fill colors with a color wheel gradient.
+     * @param pixels Colors to fill.
+     * @param count Number of colors.
+     * @param startPosition Wheel position of the first color, in 8.8 fixed point.
+     * @param delta Wheel step between two colors, in 8.8 fixed point.
+     */
+    static void fillWheelGradient(RgbColor* pixels, uint16_t count, uint16_t startPosition, uint16_t delta);
+
+private:
+    static const ColorTable HUE;    ///< Hue ramp through the six sectors of the HSV color circle.
+    static const ColorTable WHEEL;  ///< Color wheel of the classic NeoPixel rainbow.
+
+    /**
+     * @brief Fill colors with a gradient read from a table.
+     */
+    static void fillGradient(const ColorTable& table, RgbColor* pixels, uint16_t count, uint16_t start, uint16_t delta);
+};
+
+#endif //OPENHOOP_COLORTABLES_H
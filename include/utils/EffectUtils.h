@@ -14,6 +14,7 @@
 
 #include <Arduino.h>
 #include <PDM.h>
+#include "RgbColor.h"
 
 /**
  * @brief LED effect utility functions.
@@ -26,7 +27,7 @@ public:
      * @param brightness Brightness level to be applied.
      * @return Color value with brightness applied.
      */
-    static uint32_t applyBrightness(uint32_t color, int brightness);
+    static RgbColor applyBrightness(RgbColor color, uint8_t brightness);
 
     /**
      * @brief Interpolate between two colors.
@@ -36,7 +37,7 @@ public:
      * @param steps Total number of steps in the interpolation.
      * @return Interpolated color value.
      */
-    static uint32_t interpolateColor(uint32_t color1, uint32_t color2, int step, int steps);
+    static RgbColor interpolateColor(RgbColor color1, RgbColor color2, int step, int steps);
 
     /**
      * @brief Convert HSV to RGB color.
@@ -45,7 +46,7 @@ public:
      * @param value Brightness value.
      * @return RGB color value.
      */
-    static uint32_t HSVtoRGB(int hue, int saturation, int value);
+    static RgbColor HSVtoRGB(int hue, int saturation, int value);
 
     /**
      * @brief Map a value from one range to another.
@@ -63,7 +64,7 @@ public:
      * @param wheelPos Position in the color wheel.
      * @return Color value.
      */
-    static uint32_t Wheel(byte wheelPos);
+    static RgbColor Wheel(byte wheelPos);
 
     /**
      * @brief Calculate the sound spectrum intensity.
@@ -82,6 +83,27 @@ public:
      */
     static float getInclination();
 
+    /**
+     * @brief Get the gravity in the plane of the hoop from the accelerometer.
+     * @param x Receives the gravity along the X axis, 4096 per g.
+     * @param y Receives the gravity along the Y axis, 4096 per g.
+     * @return Whether a new reading was available, the outputs being left untouched otherwise.
+     */
+    static bool getGravity(int32_t& x, int32_t& y);
+
+    /**
+     * @brief Get the angle around the hoop of its lowest point, from the latest gravity read by anyone.
+     * @return Binary angle of the lowest point measured from pixel 0, a full turn spanning 65536.
+     */
+    static uint16_t getDownAngle();
+
+    /**
+     * @brief Get the rotation rate of the hoop in its own plane from the gyroscope.
+     * @param rate Receives the rotation rate in binary angle units per second, a full turn spanning 65536.
+     * @return Whether a new reading was available, the output being left untouched otherwise.
+     */
+    static bool getRotationRate(int32_t& rate);
+
 private:
     /**
      * @brief Buffer to read samples into, each sample is 16-bits.
@@ -92,6 +114,16 @@ private:
      * @brief Number of samples read.
      */
     static volatile int samplesRead;
+
+    /**
+     * @brief Gravity along the X axis at the last reading, 4096 per g.
+     */
+    static int32_t lastGravityX;
+
+    /**
+     * @brief Gravity along the Y axis at the last reading, 4096 per g.
+     */
+    static int32_t lastGravityY;
 };
 
 #endif //OPENHOOP_EFFECTUTILS_H
@@ -0,0 +1,100 @@
+/**
+ * @project OpenHoop
+ * @file FastRandom.h
+ * @brief Header file for the FastRandom class, a small deterministic pseudo-random number generator.
+ * @details Defines a xorshift32 generator with 8 and 16-bit draws and range functions that scale by multiplication
+ * instead of dividing. Each effect owns its generator, so a fixed seed replays the same frames.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_FASTRANDOM_H
+#define OPENHOOP_FASTRANDOM_H
+
+#include <stdint.h>
+
+/**
+ * @brief Xorshift32 pseudo-random number generator.
+ */
+class FastRandom {
+public:
+    static constexpr uint32_t DEFAULT_SEED = 0x9E3779B9;  ///< Seed used in place of 0, which xorshift cannot leave.
+
+    /**
+     * @brief Constructor for FastRandom.
+     * @param seed Initial state, 0 being replaced by DEFAULT_SEED.
+     */
+    explicit FastRandom(uint32_t seed = DEFAULT_SEED) : state(seed ? seed : DEFAULT_SEED) {}
+
+    /**
+     * @brief Restart the sequence from a seed.
+     * @param seed New state, 0 being replaced by DEFAULT_SEED.
+     */
+    void seed(uint32_t seed) {
+        state = seed ? seed : DEFAULT_SEED;
+    }
+
+    /**
+     * @brief Draw 32 random bits.
+     */
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    /**
+     * @brief Draw a random byte, taken from the high bits of the state.
+     */
+    uint8_t random8() {
+        return next() >> 24;
+    }
+
+    /**
+     * @brief Draw a random byte below a limit.
+     * @param limit Exclusive upper bound, up to 256.
+     */
+    uint8_t random8(uint16_t limit) {
+        return (random8() * limit) >> 8;
+    }
+
+    /**
+     * @brief Draw a random byte in a range.
+     * @param low Inclusive lower bound.
+     * @param high Exclusive upper bound, up to 256.
+     */
+    uint8_t random8(uint8_t low, uint16_t high) {
+        return low + random8(high - low);
+    }
+
+    /**
+     * @brief Draw a random 16-bit value, taken from the high bits of the state.
+     */
+    uint16_t random16() {
+        return next() >> 16;
+    }
+
+    /**
+     * @brief Draw a random 16-bit value below a limit.
+     * @param limit Exclusive upper bound, up to 65536.
+     */
+    uint16_t random16(uint32_t limit) {
+        return (random16() * limit) >> 16;
+    }
+
+    /**
+     * @brief Draw a random 16-bit value in a range.
+     * @param low Inclusive lower bound.
+     * @param high Exclusive upper bound, up to 65536.
+     */
+    uint16_t random16(uint16_t low, uint32_t high) {
+        return low + random16(high - low);
+    }
+
+private:
+    uint32_t state;  ///< Current state, never 0.
+};
+
+#endif //OPENHOOP_FASTRANDOM_H
@@ -0,0 +1,107 @@
+/**
+ * @project OpenHoop
+ * @file FixedMath.h
+ * @brief Header file for the FixedMath class, containing fixed-point trigonometry and waveform functions.
+ * @details Defines static methods computing sines, cosines and arc tangents from lookup tables in flash, and beat
+ * oscillators that turn a tempo and a time into a phase or a sine wave. Angles are binary: a full turn spans 65536 for
+ * 16-bit angles and 256 for 8-bit ones, so they wrap around for free.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_FIXEDMATH_H
+#define OPENHOOP_FIXEDMATH_H
+
+#include <stdint.h>
+
+/**
+ * @brief Fixed-point trigonometry and waveforms.
+ */
+class FixedMath {
+public:
+    static constexpr uint16_t QUARTER_TURN = 16384;  ///< 16-bit angle of a quarter turn.
+    static constexpr uint16_t HALF_TURN = 32768;     ///< 16-bit angle of a half turn.
+
+    /**
+     * @brief Sine of a 16-bit angle.
+     * @param angle Angle, a full turn spanning 65536.
+     * @return Sine from -32767 to 32767.
+     */
+    static int16_t sin16(uint16_t angle);
+
+    /**
+     * @brief Cosine of a 16-bit angle.
+     * @param angle Angle, a full turn spanning 65536.
+     * @return Cosine from -32767 to 32767.
+     */
+    static int16_t cos16(uint16_t angle);
+
+    /**
+     * @brief Sine of an 8-bit angle, offset to an unsigned byte.
+     * @param angle Angle, a full turn spanning 256.
+     * @return Sine from 0 to 255, centered on 128.
+     */
+    static uint8_t sin8(uint8_t angle);
+
+    /**
+     * @brief Cosine of an 8-bit angle, offset to an unsigned byte.
+     * @param angle Angle, a full turn spanning 256.
+     * @return Cosine from 0 to 255, centered on 128.
+     */
+    static uint8_t cos8(uint8_t angle);
+
+    /**
+     * @brief Angle of the vector (x, y).
+     * @param y Vertical component.
+     * @param x Horizontal component.
+     * @return Angle from the positive x axis, a full turn spanning 65536, or 0 for the null vector.
+     */
+    static uint16_t atan2(int32_t y, int32_t x);
+
+    /**
+     * @brief Phase of a sawtooth beating at a given tempo.
+     * @param bpm Beats per minute.
+     * @param timeMillis Time in milliseconds, usually millis().
+     * @return Phase within the current beat, a full beat spanning 65536.
+     */
+    static uint16_t beat16(uint16_t bpm, uint32_t timeMillis);
+
+    /**
+     * @brief Phase of a sawtooth beating at a given tempo.
+     * @param bpm Beats per minute.
+     * @param timeMillis Time in milliseconds, usually millis().
+     * @return Phase within the current beat, a full beat spanning 256.
+     */
+    static uint8_t beat8(uint16_t bpm, uint32_t timeMillis);
+
+    /**
+     * @brief Sine wave beating at a given tempo between two values.
+     * @param bpm Beats per minute.
+     * @param low Lowest value of the wave.
+     * @param high Highest value of the wave.
+     * @param timeMillis Time in milliseconds, usually millis().
+     * @param phaseOffset Phase added to the beat, a full beat spanning 65536.
+     * @return Value of the wave.
+     */
+    static uint16_t beatsin16(uint16_t bpm, uint16_t low, uint16_t high, uint32_t timeMillis, uint16_t phaseOffset = 0);
+
+    /**
+     * @brief Sine wave beating at a given tempo between two values.
+     * @param bpm Beats per minute.
+     * @param low Lowest value of the wave.
+     * @param high Highest value of the wave.
+     * @param timeMillis Time in milliseconds, usually millis().
+     * @param phaseOffset Phase added to the beat, a full beat spanning 256.
+     * @return Value of the wave.
+     */
+    static uint8_t beatsin8(uint16_t bpm, uint8_t low, uint8_t high, uint32_t timeMillis, uint8_t phaseOffset = 0);
+
+private:
+    /**
+     * @brief Arc tangent of a ratio between 0 and 1.
+     */
+    static uint16_t atanRatio(uint32_t numerator, uint32_t denominator);
+};
+
+#endif //OPENHOOP_FIXEDMATH_H
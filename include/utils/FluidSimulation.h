@@ -0,0 +1,104 @@
+/**
+ * @project OpenHoop
+ * @file FluidSimulation.h
+ * @brief Header file for the FluidSimulation class, a shallow-water simulation around the hoop, and its TapDetector.
+ * @details Defines the FluidSimulation class, which moves a liquid around a ring of cells in fixed point: each cell
+ * holds a depth, each boundary between two cells a flow velocity, and the flow is driven by the slope of the surface
+ * and the gravity along the hoop. It does not read any sensor, so recorded gravity traces replay exactly on any machine.
+ * The TapDetector class turns sudden jumps in the gravity readings into ripples.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_FLUIDSIMULATION_H
+#define OPENHOOP_FLUIDSIMULATION_H
+
+#include <stdint.h>
+#include "../Config.h"
+
+/**
+ * @brief Shallow-water simulation on a ring of cells.
+ */
+class FluidSimulation {
+public:
+    static constexpr uint16_t MAX_CELLS = NUM_LEDS;  ///< Maximum number of cells.
+    static constexpr int16_t MAX_VELOCITY = 1536;  ///< Fastest flow, in 1/4096 of a cell per step.
+
+    /**
+     * @brief Fill every cell to the same level and stop the flow.
+     * @param cellCount Number of cells on the ring, up to MAX_CELLS.
+     * @param level Depth of each cell, 256 per pixel.
+     */
+    void reset(uint16_t cellCount, uint16_t level);
+
+    /**
+     * @brief Advance the liquid by a step.
+     * @details Several steps per frame keep the waves fast while each step stays stable.
+     * @param gravityX Gravity along the X axis of the hoop, 4096 per g.
+     * @param gravityY Gravity along the Y axis of the hoop, 4096 per g.
+     */
+    void step(int32_t gravityX, int32_t gravityY);
+
+    /**
+     * @brief Push the liquid away from a cell, starting a ripple on both sides.
+     * @param cell Cell at the center of the ripple.
+     * @param strength Velocity given to the liquid on both sides, 1/4096 of a cell per step.
+     */
+    void splash(uint16_t cell, int16_t strength);
+
+    /**
+     * @brief Get the depth of a cell, 256 per pixel.
+     */
+    uint16_t getDepth(uint16_t cell) const;
+
+    /**
+     * @brief Get the total depth of all the cells, which the steps keep constant.
+     */
+    uint32_t getVolume() const;
+
+    /**
+     * @brief Get the number of cells on the ring.
+     */
+    uint16_t getSize() const;
+
+private:
+    uint16_t size = 0;  ///< Number of cells on the ring.
+    uint16_t depth[MAX_CELLS] = {};  ///< Depth of each cell, 256 per pixel.
+    int16_t velocity[MAX_CELLS] = {};  ///< Flow from each cell to the next one, 1/4096 of a cell per step.
+};
+
+/**
+ * @brief Detects taps on the hoop from the gravity readings and splashes the liquid where it pools.
+ * @details The filtered gravity follows the readings an eighth of the way per reading. A reading that jumps away from it
+ * by more than the threshold is a tap, after which taps are ignored for a few readings while the hoop settles.
+ */
+class TapDetector {
+public:
+    static constexpr int32_t DEFAULT_THRESHOLD = 3072;  ///< Default jump in gravity counted as a tap, 4096 per g.
+    static constexpr uint8_t COOLDOWN = 10;  ///< Readings ignored after a tap.
+
+    /**
+     * @brief Constructor for the TapDetector class.
+     * @details Gravity starts pointing at cell 0 until the first reading.
+     * @param threshold Jump in gravity counted as a tap, 4096 per g.
+     */
+    explicit TapDetector(int32_t threshold = DEFAULT_THRESHOLD);
+
+    /**
+     * @brief Filter a gravity reading and splash the liquid at its lowest cell on a tap.
+     * @param gravityX Gravity along the X axis of the hoop, 4096 per g.
+     * @param gravityY Gravity along the Y axis of the hoop, 4096 per g.
+     * @param fluid Liquid to splash, with a strength given by the jump and limited to MAX_VELOCITY.
+     * @return Whether the reading was a tap.
+     */
+    bool addReading(int32_t gravityX, int32_t gravityY, FluidSimulation& fluid);
+
+private:
+    int32_t threshold;      ///< Jump in gravity counted as a tap, 4096 per g.
+    uint8_t cooldown = 0;   ///< Readings left before another tap is detected.
+    int32_t filteredX = 4096;  ///< Gravity along the X axis with the shaking filtered out.
+    int32_t filteredY = 0;     ///< Gravity along the Y axis with the shaking filtered out.
+};
+
+#endif //OPENHOOP_FLUIDSIMULATION_H
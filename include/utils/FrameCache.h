@@ -0,0 +1,71 @@
+/**
+ * @project OpenHoop
+ * @file FrameCache.h
+ * @brief Header file for the FrameCache class, a least-recently-used cache of rendered frames.
+ * @details Defines the FrameCache class, which lets effects whose frames only depend on a small key, such as the image
+ * column they show, render each frame once and copy it back afterwards. The cache holds as many frames as fit in
+ * FRAME_CACHE_BYTES and evicts the least recently used one when full.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_FRAMECACHE_H
+#define OPENHOOP_FRAMECACHE_H
+
+#include <stdint.h>
+#include "RgbColor.h"
+#include "../Config.h"
+
+/**
+ * @brief Least-recently-used cache of rendered frames within a fixed RAM budget.
+ */
+class FrameCache {
+public:
+    static constexpr uint8_t MAX_FRAMES = 64;  ///< Maximum number of cached frames, however small they are.
+
+    /**
+     * @brief Copy a cached frame out, if there is one.
+     * @details Frames of a different size than the cached ones clear the cache.
+     * @param key Key the frame was stored under.
+     * @param frame Receives the cached frame.
+     * @param pixels Number of pixels of the frame.
+     * @return Whether the frame was cached.
+     */
+    bool fetch(uint32_t key, RgbColor* frame, uint16_t pixels);
+
+    /**
+     * @brief Cache a copy of a frame, evicting the least recently used one when the cache is full.
+     * @param key Key to store the frame under, which must not be cached already.
+     * @param frame Frame to cache.
+     * @param pixels Number of pixels of the frame.
+     */
+    void store(uint32_t key, const RgbColor* frame, uint16_t pixels);
+
+    /**
+     * @brief Drop every cached frame.
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of frames of a size that fit in the cache.
+     * @param pixels Number of pixels of each frame.
+     */
+    static uint8_t getCapacity(uint16_t pixels);
+
+private:
+    /**
+     * @brief Clear the cache and split it into frames of a new size.
+     */
+    void resize(uint16_t pixels);
+
+    uint16_t framePixels = 0;  ///< Number of pixels of each cached frame.
+    uint8_t capacity = 0;      ///< Number of frames that fit in the storage.
+    uint8_t count = 0;         ///< Number of cached frames.
+    uint32_t clock = 0;        ///< Counter stamped on a frame whenever it is stored or fetched.
+    uint32_t keys[MAX_FRAMES] = {};      ///< Key of each cached frame.
+    uint32_t lastUse[MAX_FRAMES] = {};   ///< Clock of the last use of each cached frame.
+    RgbColor storage[FRAME_CACHE_BYTES / sizeof(RgbColor)];  ///< Cached frames, one after the other.
+};
+
+#endif //OPENHOOP_FRAMECACHE_H
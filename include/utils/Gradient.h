@@ -0,0 +1,64 @@
+/**
+ * @project OpenHoop
+ * @file Gradient.h
+ * @brief Header file for the Gradient class, containing gradient fills.
+ * @details Defines the gradient stop and interpolation mode types and the static methods that fill a run of colors with
+ * a gradient between two colors or through several stops. Channels are stepped with fixed-point accumulators, so
+ * each pixel costs a few additions once a span is set up.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_GRADIENT_H
+#define OPENHOOP_GRADIENT_H
+
+#include <stdint.h>
+#include "RgbColor.h"
+
+/**
+ * @brief Space in which gradient colors are interpolated.
+ */
+enum class GradientMode {
+    LINEAR,     ///< Interpolate the 8-bit channel values directly.
+    PERCEPTUAL  ///< Interpolate channels compressed like OKLab lightness, so dark ends do not dominate the blend.
+};
+
+/**
+ * @brief Color at a position along a gradient.
+ */
+struct GradientStop {
+    uint8_t position;  ///< Position along the gradient, from 0 (start) to 255 (end).
+    RgbColor color;    ///< Color at the position.
+};
+
+/**
+ * @brief Gradient fills.
+ */
+class Gradient {
+public:
+    /**
+     * @brief Fill colors with a gradient between two colors.
+     * @param pixels Colors to fill.
+     * @param count Number of colors.
+     * @param start Color of the first pixel.
+     * @param end Color the gradient reaches just past the last pixel.
+     * @param mode Interpolation space.
+     */
+    static void fill(RgbColor* pixels, uint16_t count, RgbColor start, RgbColor end,
+                     GradientMode mode = GradientMode::LINEAR);
+
+    /**
+     * @brief Fill colors with a gradient through several stops.
+     * @details Pixels before the first stop take its color, and the last stop holds until the end.
+     * @param pixels Colors to fill.
+     * @param count Number of colors.
+     * @param stops Stops sorted by position.
+     * @param stopCount Number of stops.
+     * @param mode Interpolation space.
+     */
+    static void fill(RgbColor* pixels, uint16_t count, const GradientStop* stops, uint8_t stopCount,
+                     GradientMode mode = GradientMode::LINEAR);
+};
+
+#endif //OPENHOOP_GRADIENT_H
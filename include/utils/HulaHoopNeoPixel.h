@@ -4,7 +4,7 @@
  * @brief Header file for the HulaHoopNeoPixel class, providing functionality for managing NeoPixels with energy-saving
  * modes.
  * @details This class extends the Adafruit_NeoPixel library to include energy-saving modes and dynamic pixel
- * management.
+ * management. Effects render into a logical frame which is composed onto the physical strip when the frame is shown.
  * @author github.com/angelcamelot
  * @date 2024-04-07
  * @license Open-source license.
@@ -14,6 +14,24 @@
 #define OPENHOOP_HULAHOOPNEOPIXEL_H
 
 #include <Adafruit_NeoPixel.h>
+#include "RgbColor.h"
+
+/**
+ * @brief Symmetry used to replicate the logical frame around the hoop.
+ */
+enum class SymmetryMode : uint8_t {
+    NONE,    ///< The logical frame covers the whole hoop.
+    MIRROR,  ///< Every other segment is a mirrored copy of the logical frame.
+    ROTATE,  ///< Every segment is a rotated copy of the logical frame.
+};
+
+/**
+ * @brief Interpolation used to upsample a low-resolution logical frame to the active pixels.
+ */
+enum class UpsampleMode : uint8_t {
+    NEAREST,  ///< Each active pixel repeats the closest logical pixel.
+    LINEAR,   ///< Each active pixel blends the two closest logical pixels.
+};
 
 class HulaHoopNeoPixel : public Adafruit_NeoPixel {
 private:
@@ -22,9 +40,45 @@ private:
      */
     void applyEnergySavingMode(uint8_t level);
 
+    /**
+     * @brief Recomputes the number of logical pixels from the energy-saving mode, symmetry and render resolution.
+     */
+    void updateLogicalPixels();
+
+    /**
+     * @brief Widens the logical frame into the 16-bit render frame, interpolating it with the previous frame if enabled.
+     */
+    void prepareRenderFrame();
+
+    /**
+     * @brief Composes the render frame onto the physical pixels.
+     */
+    void composeFrame();
+
+    /**
+     * @brief Quantizes a 16-bit channel to 8 bits, carrying the rounding error over to the next frame.
+     */
+    static uint8_t quantize(uint32_t value, uint8_t& error);
+
     uint8_t brightnessLevel; ///< Brightness level of the NeoPixels.
     uint16_t activePixels; ///< Number of active pixels.
     uint16_t energySavingModeLevel; ///< Energy-saving mode level (0-8).
+    uint8_t pixelStride; ///< Distance between two active physical pixels.
+    SymmetryMode symmetryMode; ///< Symmetry used to replicate the logical frame.
+    uint8_t symmetryFolds; ///< Number of copies of the logical frame around the hoop.
+    uint8_t requestedFolds; ///< Number of copies requested, reduced to symmetryFolds when there are fewer active pixels.
+    uint16_t renderResolution; ///< Requested number of logical pixels per fold, 0 for full resolution.
+    UpsampleMode upsampleMode; ///< Interpolation used to upsample the logical frame.
+    uint16_t segmentPixels; ///< Number of active pixels covered by each fold.
+    uint16_t logicalPixels; ///< Number of pixels effects render.
+    RgbColor* frame; ///< Logical frame effects render into.
+    RgbColor* previousFrame; ///< Logical frame rendered by the previous simulation step.
+    uint16_t* renderFrame; ///< Logical frame widened to 8.8 fixed point, plus one wrap-around pixel.
+    uint8_t* ditherError; ///< Rounding error carried over to the next frame, three bytes per physical pixel.
+    bool frameInterpolation; ///< Whether shown frames are interpolated between the last two rendered frames.
+    uint16_t frameBlend; ///< Weight of the current frame against the previous one (0-256).
+    uint32_t lastShowMicros; ///< Time in microseconds at which show() was last called.
+    uint16_t rotationAngle; ///< Binary angle the hoop turned by, which the composed frame is turned back by.
 
 public:
     /**
@@ -33,19 +87,88 @@ public:
     HulaHoopNeoPixel(uint16_t n, uint8_t p, neoPixelType t = NEO_GRB + NEO_KHZ800);
 
     /**
-     * @brief Override of setPixelColor to apply energy saving mode.
+     * @brief Destructor for the HulaHoopNeoPixel class.
+     */
+    ~HulaHoopNeoPixel();
+
+    /**
+     * @brief Override of setPixelColor to write into the logical frame.
      */
     void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
 
+    /**
+     * @brief Override of setPixelColor to write a packed color into the logical frame.
+     */
+    void setPixelColor(uint16_t n, RgbColor color);
+
+    /**
+     * @brief Override of fill to write into the logical frame.
+     */
+    void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+
+    /**
+     * @brief Override of show to compose the logical frame before sending it to the strip.
+     */
+    void show();
+
+    /**
+     * @brief Sends the first pixels of the logical frame straight to the strip, as fast as it can refresh.
+     * @details Skips the symmetry, upsampling, frame interpolation and dithering of show() and transmits only the first
+     * count active pixels, whether they changed or not, for effects such as persistence of vision that refresh far more
+     * often than frames. The pixels further down the strip keep the colors they latched last.
+     */
+    void showPixels(uint16_t count);
+
     /**
      * @brief Sets the energy-saving mode level.
      */
     void setEnergySavingMode(uint8_t level);
 
     /**
-     * @brief Gets the number of active pixels.
+     * @brief Sets the symmetry used to replicate the logical frame around the hoop.
+     */
+    void setSymmetry(SymmetryMode mode, uint8_t folds);
+
+    /**
+     * @brief Sets the resolution effects render at before being upsampled to the active pixels.
+     */
+    void setResolution(uint16_t resolution, UpsampleMode mode);
+
+    /**
+     * @brief Sets the angle the hoop turned by, so the composed frame is turned back and stays still in the world.
+     */
+    void setRotation(uint16_t angle);
+
+    /**
+     * @brief Enables or disables interpolation between the last two rendered frames.
+     */
+    void setFrameInterpolation(bool enabled);
+
+    /**
+     * @brief Keeps the current logical frame as the previous one before the effect renders the next.
+     */
+    void commitFrame();
+
+    /**
+     * @brief Sets the weight of the current frame against the previous one when interpolating.
+     */
+    void setFrameBlend(uint16_t weight);
+
+    /**
+     * @brief Gets the number of pixels effects render.
      */
     uint16_t getActivePixels();
+
+    /**
+     * @brief Gets the logical frame effects render into, getActivePixels() colors long.
+     * @details Whole-frame operations such as ColorKernels can work on it directly instead of going pixel by pixel.
+     */
+    RgbColor* getFrame();
+
+    /**
+     * @brief Gets the time in microseconds at which show() was last called.
+     */
+    uint32_t getLastShowMicros() const;
 };
 
 #endif //OPENHOOP_HULAHOOPNEOPIXEL_H
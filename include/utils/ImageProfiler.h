@@ -0,0 +1,38 @@
+/**
+ * @project OpenHoop
+ * @file ImageProfiler.h
+ * @brief Header file for the ImageProfiler class, a benchmark of the image decoders.
+ * @details Defines the ImageProfiler class, which times the column decoding of the images shipped with the firmware on
+ * the hoop itself, each in the format it is stored in. The host suite test_image_formats times every image in both
+ * formats.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_IMAGEPROFILER_H
+#define OPENHOOP_IMAGEPROFILER_H
+
+#include "../images/LedImage.h"
+
+/**
+ * @brief Benchmark of the image decoders.
+ */
+class ImageProfiler {
+public:
+    /**
+     * @brief Decode every column of every image IMAGE_PROFILING_PASSES times and print the time per pixel over Serial.
+     */
+    static void report();
+
+private:
+    /**
+     * @brief Time the column decoding of an image and print it over Serial.
+     * @param name Name printed with the result.
+     * @param format Storage format printed with the result.
+     * @param image Image to decode.
+     */
+    static void profile(const char* name, const char* format, LedImage& image);
+};
+
+#endif //OPENHOOP_IMAGEPROFILER_H
@@ -0,0 +1,104 @@
+/**
+ * @project OpenHoop
+ * @file Palette.h
+ * @brief Header file for the palette types, mapping 8-bit indices to colors.
+ * @details Defines gradient palettes stored in flash as a list of stops, compact 16-color palettes, and the 256-color
+ * RAM palette effects expand them into when they start, so rendering a pixel costs a single indexed load.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_PALETTE_H
+#define OPENHOOP_PALETTE_H
+
+#include <stdint.h>
+#include "RgbColor.h"
+#include "Gradient.h"
+
+/**
+ * @brief Palette defined by gradient stops, meant to live in flash.
+ */
+struct GradientPalette {
+    const GradientStop* stops;  ///< Stops sorted by position, from 0 to 255.
+    uint8_t count;              ///< Number of stops.
+};
+
+/**
+ * @brief Palette of 16 evenly spaced colors, interpolated in between.
+ */
+struct Palette16 {
+    RgbColor colors[16];  ///< Colors at indices 0, 16, 32 and so on up to 240.
+
+    /**
+     * @brief Get the color at an index, blending the two nearest entries.
+     * @param index Palette index, wrapping from the last entry back to the first.
+     * @return Color at the index.
+     */
+    RgbColor color(uint8_t index) const;
+};
+
+/**
+ * @brief Palette of 256 colors held in RAM.
+ */
+class Palette256 {
+public:
+    static const GradientPalette OCEAN;  ///< Blues and greens of tranquil waters, wrapping back to the first color.
+    static const GradientPalette FUNKY;  ///< Teal, mint, magenta, yellow and pink, wrapping back to teal.
+    static const GradientPalette HEAT;   ///< Black through red and yellow to white, indexed by temperature.
+
+    /**
+     * @brief Constructor for Palette256, filled with black.
+     */
+    Palette256();
+
+    /**
+     * @brief Expand a gradient palette.
+     * @param palette Palette to expand.
+     * @param mode Interpolation space between the stops.
+     */
+    void load(const GradientPalette& palette, GradientMode mode = GradientMode::LINEAR);
+
+    /**
+     * @brief Expand a list of gradient stops.
+     * @param stops Stops sorted by position.
+     * @param count Number of stops.
+     * @param mode Interpolation space between the stops.
+     */
+    void load(const GradientStop* stops, uint8_t count, GradientMode mode = GradientMode::LINEAR);
+
+    /**
+     * @brief Expand a 16-color palette.
+     * @param palette Palette to expand.
+     */
+    void load(const Palette16& palette);
+
+    /**
+     * @brief Get the color at an index.
+     */
+    RgbColor operator[](uint8_t index) const {
+        return colors[index];
+    }
+
+    /**
+     * @brief Get the color at a fractional position, blending the two nearest entries.
+     * @param position Palette position in 8.8 fixed point, wrapping from the last entry back to the first.
+     * @return Color at the position.
+     */
+    RgbColor blend(uint16_t position) const;
+
+    /**
+     * @brief Fill colors with a run through the palette.
+     * @param pixels Colors to fill.
+     * @param count Number of colors.
+     * @param start Palette position of the first color, in 8.8 fixed point.
+     * @param delta Palette step between two colors, in 8.8 fixed point.
+     * @param blended Whether to blend neighbouring entries instead of taking the nearest lower one.
+     */
+    void fill(RgbColor* pixels, uint16_t count, uint16_t start, uint16_t delta, bool blended = false) const;
+
+private:
+    RgbColor colors[256];  ///< Color at each index.
+};
+
+#endif //OPENHOOP_PALETTE_H
@@ -0,0 +1,69 @@
+/**
+ * @project OpenHoop
+ * @file ParticleSystem.h
+ * @brief Header file for the ParticleSystem class, a fixed-capacity pool of particles moving around the hoop.
+ * @details Defines the ParticleSystem class, which keeps its particles as a structure of arrays with fixed-point
+ * positions and velocities along the hoop, pulls them with the component of gravity along the hoop, and renders them
+ * additively with sub-pixel anti-aliasing. Nothing is allocated after construction.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_PARTICLESYSTEM_H
+#define OPENHOOP_PARTICLESYSTEM_H
+
+#include <stdint.h>
+#include "RgbColor.h"
+
+/**
+ * @brief Fixed-capacity pool of particles moving around the hoop.
+ */
+class ParticleSystem {
+public:
+    static constexpr uint16_t CAPACITY = 256;  ///< Maximum number of live particles.
+
+    /**
+     * @brief Remove every particle.
+     */
+    void clear();
+
+    /**
+     * @brief Add a particle, unless the pool is full.
+     * @param position Angle around the hoop, a full turn spanning 65536, with pixel 0 at angle 0.
+     * @param velocity Angle travelled per update, in sixteenths of an angle unit.
+     * @param life Updates left before the particle dies, also used as its brightness.
+     * @param color Color at full life.
+     * @return Whether the particle was added.
+     */
+    bool spawn(uint16_t position, int16_t velocity, uint8_t life, RgbColor color);
+
+    /**
+     * @brief Move the particles by an update and remove the dead ones.
+     * @param gravityX Gravity along the X axis of the hoop, 4096 per g.
+     * @param gravityY Gravity along the Y axis of the hoop, 4096 per g.
+     * @param decay Life lost by each particle per update.
+     */
+    void update(int32_t gravityX, int32_t gravityY, uint8_t decay);
+
+    /**
+     * @brief Add the particles to a frame, splitting each one between the two pixels around it.
+     * @param pixels Frame to draw into.
+     * @param count Number of pixels in the frame, spread evenly around the hoop.
+     */
+    void render(RgbColor* pixels, uint16_t count) const;
+
+    /**
+     * @brief Get the number of live particles.
+     */
+    uint16_t getCount() const;
+
+private:
+    uint16_t count = 0;  ///< Number of live particles, stored first in each array.
+    uint16_t position[CAPACITY];  ///< Angle of each particle around the hoop.
+    int16_t velocity[CAPACITY];  ///< Angle travelled by each particle per update, in sixteenths.
+    uint8_t life[CAPACITY];  ///< Updates left for each particle.
+    RgbColor color[CAPACITY];  ///< Color of each particle at full life.
+};
+
+#endif //OPENHOOP_PARTICLESYSTEM_H
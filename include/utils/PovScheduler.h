@@ -0,0 +1,76 @@
+/**
+ * @project OpenHoop
+ * @file PovScheduler.h
+ * @brief Header file for the PovScheduler class, which picks the image column to show at each angle of the hoop.
+ * @details Defines the PovScheduler class, which splits a turn of the hoop into image columns so an image shown one
+ * column at a time appears in the air as the hoop spins, and the PovStats struct, which measures how precisely the
+ * columns are switched. Angles and rates are plain numbers, so recorded rotations replay identically on a computer.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_POVSCHEDULER_H
+#define OPENHOOP_POVSCHEDULER_H
+
+#include <stdint.h>
+
+/**
+ * @brief Timing of the columns switched since the statistics were last cleared.
+ */
+struct PovStats {
+    uint32_t columns = 0;         ///< Columns switched to.
+    uint32_t missedColumns = 0;   ///< Columns skipped because the hoop turned past them between two polls.
+    uint32_t turns = 0;           ///< Turns completed, in either direction.
+    uint32_t timedColumns = 0;    ///< Columns whose switching delay was measured.
+    uint32_t totalDelay = 0;      ///< Sum of the delays between reaching a column and switching to it, in microseconds.
+    uint32_t maxDelay = 0;        ///< Longest delay between reaching a column and switching to it, in microseconds.
+};
+
+/**
+ * @brief Picks the image column to show at each angle of the hoop.
+ */
+class PovScheduler {
+public:
+    static constexpr int32_t MIN_TIMED_RATE = 8192;  ///< Slowest rate whose delays are measured, 1/8 turn per second.
+
+    /**
+     * @brief Split a turn into columns and start from no column.
+     * @param columnsPerTurn Number of columns per turn, at least 1.
+     */
+    void reset(uint16_t columnsPerTurn);
+
+    /**
+     * @brief Check whether the hoop reached another column.
+     * @details Column c covers the angles from c / columnsPerTurn to (c + 1) / columnsPerTurn of a turn, so the image
+     * keeps its place in the air whichever way the hoop turns.
+     * @param angle Rotation angle at the instant the column would be shown, a full turn spanning 2^32.
+     * @param rate Rotation rate in binary angle units per second, used to turn angles into delays.
+     * @param column Receives the column reached, when it changed.
+     * @return Whether the column changed since the last poll.
+     */
+    bool poll(uint32_t angle, int32_t rate, uint16_t& column);
+
+    /**
+     * @brief Get the column at an angle.
+     * @param angle Rotation angle, a full turn spanning 2^32.
+     */
+    uint16_t columnAt(uint32_t angle) const;
+
+    /**
+     * @brief Get the timing of the columns switched since the statistics were last cleared.
+     */
+    const PovStats& getStats() const;
+
+    /**
+     * @brief Clear the timing statistics.
+     */
+    void clearStats();
+
+private:
+    uint16_t columns = 1;            ///< Number of columns per turn.
+    int32_t currentColumn = -1;      ///< Column shown, -1 before the first poll.
+    PovStats stats;                  ///< Timing since the statistics were last cleared.
+};
+
+#endif //OPENHOOP_POVSCHEDULER_H
@@ -0,0 +1,140 @@
+/**
+ * @project OpenHoop
+ * @file RgbColor.h
+ * @brief Header file for the RgbColor struct, a packed 3-byte RGB color.
+ * @details Defines the RgbColor struct with constexpr construction and saturating fixed-point operators, along with the
+ * 8-bit arithmetic helpers they are built on.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_RGBCOLOR_H
+#define OPENHOOP_RGBCOLOR_H
+
+#include <stdint.h>
+
+/**
+ * @brief Add two 8-bit values, saturating at 255.
+ */
+constexpr uint8_t qadd8(uint8_t a, uint8_t b) {
+    return a + b > 255 ? 255 : a + b;
+}
+
+/**
+ * @brief Subtract two 8-bit values, saturating at 0.
+ */
+constexpr uint8_t qsub8(uint8_t a, uint8_t b) {
+    return a > b ? a - b : 0;
+}
+
+/**
+ * @brief Scale an 8-bit value by scale/256, where a scale of 255 leaves the value unchanged.
+ */
+constexpr uint8_t scale8(uint8_t value, uint8_t scale) {
+    return (value * (scale + 1)) >> 8;
+}
+
+/**
+ * @brief Linear interpolation between two 8-bit values by frac/256.
+ */
+constexpr uint8_t lerp8(uint8_t a, uint8_t b, uint8_t frac) {
+    return a + (((b - a) * frac) >> 8);
+}
+
+/**
+ * @brief Packed RGB color, three bytes per color.
+ */
+struct RgbColor {
+    uint8_t red;    ///< Red component of the color.
+    uint8_t green;  ///< Green component of the color.
+    uint8_t blue;   ///< Blue component of the color.
+
+    /**
+     * @brief Default constructor initializes to black.
+     */
+    constexpr RgbColor() : red(0), green(0), blue(0) {}
+
+    /**
+     * @brief Constructor for RgbColor struct.
+     * @param r Red component.
+     * @param g Green component.
+     * @param b Blue component.
+     */
+    constexpr RgbColor(uint8_t r, uint8_t g, uint8_t b) : red(r), green(g), blue(b) {}
+
+    /**
+     * @brief Create a color from a 0xRRGGBB packed value.
+     */
+    static constexpr RgbColor fromPacked(uint32_t color) {
+        return {static_cast<uint8_t>(color >> 16), static_cast<uint8_t>(color >> 8), static_cast<uint8_t>(color)};
+    }
+
+    /**
+     * @brief Get the color as a 0xRRGGBB packed value.
+     */
+    constexpr uint32_t packed() const {
+        return (static_cast<uint32_t>(red) << 16) | (static_cast<uint32_t>(green) << 8) | blue;
+    }
+
+    /**
+     * @brief Add two colors, saturating each channel at 255.
+     */
+    constexpr RgbColor operator+(RgbColor other) const {
+        return {qadd8(red, other.red), qadd8(green, other.green), qadd8(blue, other.blue)};
+    }
+
+    /**
+     * @brief Subtract two colors, saturating each channel at 0.
+     */
+    constexpr RgbColor operator-(RgbColor other) const {
+        return {qsub8(red, other.red), qsub8(green, other.green), qsub8(blue, other.blue)};
+    }
+
+    /**
+     * @brief Add a color to this one, saturating each channel at 255.
+     */
+    RgbColor& operator+=(RgbColor other) {
+        return *this = *this + other;
+    }
+
+    constexpr bool operator==(RgbColor other) const {
+        return red == other.red && green == other.green && blue == other.blue;
+    }
+
+    constexpr bool operator!=(RgbColor other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Get this color scaled by scale/256, where a scale of 255 leaves it unchanged.
+     */
+    constexpr RgbColor scale8(uint8_t scale) const {
+        return {::scale8(red, scale), ::scale8(green, scale), ::scale8(blue, scale)};
+    }
+
+    /**
+     * @brief Get this color with each channel scaled by the matching channel of another color.
+     */
+    constexpr RgbColor scale8(RgbColor scale) const {
+        return {::scale8(red, scale.red), ::scale8(green, scale.green), ::scale8(blue, scale.blue)};
+    }
+
+    /**
+     * @brief Scale this color in place by scale/256, where a scale of 255 leaves it unchanged.
+     */
+    RgbColor& nscale8(uint8_t scale) {
+        return *this = scale8(scale);
+    }
+
+    /**
+     * @brief Linear interpolation between two colors by frac/256.
+     */
+    static constexpr RgbColor lerp8(RgbColor a, RgbColor b, uint8_t frac) {
+        return {::lerp8(a.red, b.red, frac), ::lerp8(a.green, b.green, frac), ::lerp8(a.blue, b.blue, frac)};
+    }
+};
+
+static_assert(sizeof(RgbColor) == 3, "RgbColor must stay packed in three bytes");
+
+#endif //OPENHOOP_RGBCOLOR_H
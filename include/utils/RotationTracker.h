@@ -0,0 +1,65 @@
+/**
+ * @project OpenHoop
+ * @file RotationTracker.h
+ * @brief Header file for the RotationTracker class, an estimate of the rotation of the hoop from its gyroscope.
+ * @details Defines the RotationTracker class, which integrates the rotation rate of the hoop into a rotation angle and
+ * extrapolates it between gyroscope readings, so the angle can be read at any instant with sub-degree resolution. It
+ * takes the readings as plain numbers, so recorded gyroscope traces replay identically on a computer.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ROTATIONTRACKER_H
+#define OPENHOOP_ROTATIONTRACKER_H
+
+#include <stdint.h>
+
+/**
+ * @brief Estimate of the rotation angle and speed of the hoop.
+ */
+class RotationTracker {
+public:
+    static constexpr uint32_t MAX_EXTRAPOLATION = 50000;  ///< Microseconds an angle is extrapolated past the last reading.
+
+    /**
+     * @brief Forget the readings and restart from an angle.
+     * @param startAngle Rotation angle to start from, a full turn spanning 2^32.
+     */
+    void reset(uint32_t startAngle = 0);
+
+    /**
+     * @brief Add a gyroscope reading.
+     * @details The angle advances by the average of this rate and the previous one over the time between them.
+     * @param rate Rotation rate in binary angle units per second, a full turn spanning 65536.
+     * @param time Time of the reading in microseconds.
+     */
+    void addReading(int32_t rate, uint32_t time);
+
+    /**
+     * @brief Get the rotation angle at an instant, extrapolated from the last reading at its rate.
+     * @param time Time in microseconds, at most MAX_EXTRAPOLATION past the last reading to be extrapolated.
+     * @return Rotation angle, a full turn spanning 2^32.
+     */
+    uint32_t getAngle(uint32_t time) const;
+
+    /**
+     * @brief Get the rotation rate, averaged over the last readings.
+     * @return Rotation rate in binary angle units per second.
+     */
+    int32_t getRate() const;
+
+private:
+    /**
+     * @brief Get the angle travelled at a rate over a duration.
+     */
+    static uint32_t advance(int32_t rate, uint32_t duration);
+
+    bool started = false;   ///< Whether a reading was added since the last reset.
+    uint32_t angle = 0;     ///< Rotation angle at the last reading, a full turn spanning 2^32.
+    uint32_t lastTime = 0;  ///< Time of the last reading in microseconds.
+    int32_t lastRate = 0;   ///< Rate of the last reading.
+    int32_t averageRate = 0;  ///< Rate averaged over the last readings.
+};
+
+#endif //OPENHOOP_ROTATIONTRACKER_H
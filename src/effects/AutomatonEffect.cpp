@@ -0,0 +1,90 @@
+/**
+ * @project OpenHoop
+ * @file AutomatonEffect.cpp
+ * @brief Implementation file for the AutomatonEffect class, representing an LED effect running a cellular automaton.
+ * @details Defines the methods to start, update, and stop the automaton effect. Each update steps a generation, fades
+ * the previous frame into a trail and draws the current cells over it.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/effects/AutomatonEffect.h"
+#include "../../include/utils/ColorKernels.h"
+
+/**
+ * @brief Constructor for AutomatonEffect.
+ */
+AutomatonEffect::AutomatonEffect(uint32_t ruleCode, uint32_t seed)
+    : rule(AutomatonRule::fromCode(ruleCode)), seedRandom(seed) {}
+
+/**
+ * @brief Initializes the Effect.
+ * Expands the palette and seeds the automaton.
+ */
+void AutomatonEffect::start() {
+    palette.load(Palette256::FUNKY);
+    hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+    restart();
+}
+
+/**
+ * @brief Clears the automaton and seeds it again.
+ * Elementary rules grow from a single cell, the others from a random third of the cells.
+ */
+void AutomatonEffect::restart() {
+    automaton.reset(hoop.getActivePixels(), rule);
+    if (rule.states == 0) {
+        automaton.seedCenter();
+    } else {
+        automaton.seedRandom(seedRandom, 85);
+    }
+}
+
+/**
+ * @brief Updates the Effect.
+ */
+void AutomatonEffect::update() {
+    automaton.step();
+    if (automaton.isEmpty()) {
+        restart();
+    }
+
+    // Color each state once per frame: live cells follow the generation through the palette, decaying cells drift
+    // further along it and dim as they age
+    const uint8_t states = rule.states > 2 ? rule.states : 2;
+    const auto index = static_cast<uint8_t>(automaton.getGeneration() * 2);
+    RgbColor stateColors[CellularAutomaton::MAX_STATES];
+    for (uint8_t state = 1; state < states; state++) {
+        stateColors[state] = palette[index + (state - 1) * 24].scale8(255 - (state - 1) * 255 / (states - 1));
+    }
+
+    // Leave a fading trail of the previous generations
+    RgbColor* frame = hoop.getFrame();
+    const uint16_t pixels = hoop.getActivePixels();
+    ColorKernels::fadeToBlack(frame, pixels, 96);
+
+    for (uint16_t i = 0; i < pixels; i++) {
+        const uint8_t state = automaton.getState(i);
+        if (state) {
+            frame[i] = stateColors[state];
+        }
+    }
+
+    hoop.show();
+}
+
+/**
+ * @brief Replaces the palette of the Effect.
+ */
+void AutomatonEffect::setPalette(const Palette256& newPalette) {
+    palette = newPalette;
+}
+
+/**
+ * @brief Stops the Effect.
+ * Turns off all LEDs on the display.
+ */
+void AutomatonEffect::stop() {
+    hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+}
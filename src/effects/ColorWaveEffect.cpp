@@ -9,13 +9,13 @@
  */
 
 #include "../../include/effects/ColorWaveEffect.h"
-#include "../../include/utils/EffectUtils.h"
+#include "../../include/utils/ColorTables.h"
 #include "../../include/Config.h"
 
 /**
  * @brief Constructor for ColorWaveEffect.
  */
-ColorWaveEffect::ColorWaveEffect() : waveSpeed(5), hueOffset(0), saturation(255), brightness(255) {}
+ColorWaveEffect::ColorWaveEffect() : waveSpeed(5), hueOffset(0) {}
 
 /**
  * @brief Initializes the Effect.
@@ -28,14 +28,7 @@ void ColorWaveEffect::start() {
  * @brief Updates the Effect.
  */
 void ColorWaveEffect::update() {
-    for (int i = 0; i < hoop.getActivePixels(); i++) {
-        int hue = (i * waveSpeed + hueOffset) % 256;
-        uint32_t color = EffectUtils::HSVtoRGB(hue, saturation, brightness);
-        uint8_t r = (color >> 16) & 0xFF;
-        uint8_t g = (color >> 8) & 0xFF;
-        uint8_t b = color & 0xFF;
-        hoop.setPixelColor(i, r, g, b);
-    }
+    ColorTables::fillHueGradient(hoop.getFrame(), hoop.getActivePixels(), hueOffset << 8, waveSpeed << 8);
     hoop.show();
     hueOffset = (hueOffset + 1) % 256;
 }
@@ -2,24 +2,30 @@
  * @project OpenHoop
  * @file FireEffect.cpp
  * @brief Implementation file for the FireEffect class, representing an LED effect simulating a fire.
- * @details Defines the methods to start, update, and stop the fire effect.
+ * @details Defines the methods to start, update, and stop the fire effect. Each frame cools every cell, lets the heat
+ * rise away from the base and diffuse, ignites sparks near the base, and colors the pixels from the heat palette.
  * @author github.com/angelcamelot
  * @date 2024-03-17
  * @license Open-source license.
  */
 
 #include "../../include/effects/FireEffect.h"
-#include "../../include/Config.h"
+#include "../../include/utils/FixedMath.h"
+#include "../../include/utils/EffectUtils.h"
+#include <string.h>
 
 /**
  * @brief Constructor for FireEffect.
  */
-FireEffect::FireEffect() : cooling(100), sparking(0), numZones(3), zoneIntensity(new int[numZones]) {}
+FireEffect::FireEffect(uint32_t seed) : cooling(100), sparking(120), baseAngle(0), heat{}, sparkRandom(seed) {}
 
 /**
  * @brief Initializes the Effect.
+ * Clears the heat and expands the heat palette.
  */
 void FireEffect::start() {
+    memset(heat, 0, sizeof(heat));
+    palette.load(Palette256::HEAT);
     hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
 }
 
@@ -27,40 +33,83 @@ void FireEffect::start() {
  * @brief Updates the Effect.
  */
 void FireEffect::update() {
-    // Initialize zone intensities randomly
-    for (int z = 0; z < numZones; z++) {
-        zoneIntensity[z] = random(150, 256);  // Adjust the range according to preferences
+    const uint16_t pixels = hoop.getActivePixels();
+    const uint16_t lengths[2] = {static_cast<uint16_t>((pixels + 1) / 2), static_cast<uint16_t>(pixels / 2)};
+
+    updateBase();
+    simulateArc(heat[0], lengths[0]);
+    simulateArc(heat[1], lengths[1]);
+
+    // The first arc runs forward from the base and the second one backward from the pixel before it
+    RgbColor* frame = hoop.getFrame();
+    const uint16_t base = (static_cast<uint32_t>(baseAngle) * pixels) >> 16;
+
+    uint16_t pixel = base;
+    for (uint16_t i = 0; i < lengths[0]; i++) {
+        frame[pixel] = palette[heat[0][i]];
+        pixel = pixel + 1 < pixels ? pixel + 1 : 0;
     }
 
-    // Simulate the fire effect
-    for (int i = 0; i < hoop.getActivePixels(); i++) {
-        // Cool down each LED
-        if (random(256) < cooling) {
-            hoop.setPixelColor(i, 0,0,0);
-        }
-
-        // Ignite new pixels based on random sparks
-        if (random(256) < sparking) {
-            int y = random(hoop.getActivePixels());
-            int zone = map(y, 0, hoop.getActivePixels(), 0, numZones);  // Map the LED to a zone
-            int intensity = zoneIntensity[zone];  // Get the intensity of the zone
-
-            uint8_t r = min(255, random(intensity * 2));  // Generate a random red hue
-            uint8_t g = 0;  // Do not use green
-            uint8_t b = 0;  // Do not use blue
-
-            hoop.setPixelColor(y, r, g, b);
-        }
+    pixel = base;
+    for (uint16_t i = 0; i < lengths[1]; i++) {
+        pixel = pixel > 0 ? pixel - 1 : pixels - 1;
+        frame[pixel] = palette[heat[1][i]];
     }
 
     hoop.show();
 }
 
+/**
+ * @brief Moves the base of the flames towards the bottom of the hoop.
+ * @details The base only moves an eighth of the way each frame to filter out the shaking of the hoop.
+ */
+void FireEffect::updateBase() {
+    int32_t x, y;
+    if (!EffectUtils::getGravity(x, y)) {
+        return;
+    }
+
+    const uint16_t target = FixedMath::atan2(y, x);
+    baseAngle += static_cast<int16_t>(target - baseAngle) / 8;
+}
+
+/**
+ * @brief Advances the heat along one arc by a frame.
+ */
+void FireEffect::simulateArc(uint8_t* arc, uint16_t length) {
+    if (length == 0) {
+        return;
+    }
+
+    // Cool down every cell a little, longer arcs cooling slower so the flames keep their proportions
+    const auto coolingLimit = static_cast<uint16_t>(min(cooling * 10 / length + 2, 256));
+    for (uint16_t i = 0; i < length; i++) {
+        arc[i] = qsub8(arc[i], sparkRandom.random8(coolingLimit));
+    }
+
+    // Heat drifts away from the base and diffuses a little, 171 / 512 dividing by 3
+    for (uint16_t k = length - 1; k >= 2; k--) {
+        arc[k] = ((arc[k - 1] + 2 * arc[k - 2]) * 171) >> 9;
+    }
+
+    // Randomly ignite new sparks near the base
+    if (sparkRandom.random8() < sparking) {
+        const uint8_t y = sparkRandom.random8(length / 16 + 1);
+        arc[y] = qadd8(arc[y], sparkRandom.random8(160, 256));
+    }
+}
+
+/**
+ * @brief Replaces the palette of the Effect.
+ */
+void FireEffect::setPalette(const Palette256& newPalette) {
+    palette = newPalette;
+}
+
 /**
  * @brief Stops the Effect.
  * Turns off all LEDs on the display.
  */
 void FireEffect::stop() {
-    delete[] zoneIntensity;
     hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
 }
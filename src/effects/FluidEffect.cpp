@@ -0,0 +1,84 @@
+/**
+ * @project OpenHoop
+ * @file FluidEffect.cpp
+ * @brief Implementation file for the FluidEffect class, representing an LED effect of liquid sloshing around the hoop.
+ * @details Defines the methods to start, update, and stop the fluid effect. Each frame reads the gravity, advances the
+ * liquid by a few simulation steps and colors each pixel by the depth of the liquid above it.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/effects/FluidEffect.h"
+#include "../../include/Config.h"
+#include "../../include/utils/EffectUtils.h"
+
+constexpr uint8_t FluidEffect::SUBSTEPS;
+
+/**
+ * @brief Constructor for FluidEffect.
+ * Gravity starts pointing at pixel 0 until the accelerometer is read.
+ */
+FluidEffect::FluidEffect() : level(96), gravityX(4096), gravityY(0) {}
+
+/**
+ * @brief Initializes the Effect.
+ * Spreads the liquid evenly and expands the ocean palette.
+ */
+void FluidEffect::start() {
+    fluid.reset(hoop.getActivePixels(), level);
+    palette.load(Palette256::OCEAN);
+    hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+}
+
+/**
+ * @brief Updates the Effect.
+ */
+void FluidEffect::update() {
+    // The energy mode may have changed the active pixels since the last frame
+    const uint16_t pixels = hoop.getActivePixels();
+    if (pixels != fluid.getSize()) {
+        fluid.reset(pixels, level);
+    }
+
+    updateGravity();
+    for (uint8_t i = 0; i < SUBSTEPS; i++) {
+        fluid.step(gravityX, gravityY);
+    }
+
+    // Deeper liquid reads further along the palette, and the thin film left on dry pixels fades to black
+    RgbColor* frame = hoop.getFrame();
+    for (uint16_t i = 0; i < pixels; i++) {
+        const uint16_t depth = fluid.getDepth(i);
+        const uint8_t index = depth >= 408 ? 204 : depth / 2;
+        const uint8_t brightness = depth >= 40 ? 255 : depth <= 8 ? 0 : (depth - 8) * 8;
+        frame[i] = palette[index].scale8(brightness);
+    }
+
+    hoop.show();
+}
+
+/**
+ * @brief Reads the gravity and detects taps.
+ * @details A tap starts a ripple at the lowest pixel, where the liquid pools.
+ */
+void FluidEffect::updateGravity() {
+    if (EffectUtils::getGravity(gravityX, gravityY)) {
+        taps.addReading(gravityX, gravityY, fluid);
+    }
+}
+
+/**
+ * @brief Replaces the palette of the Effect.
+ */
+void FluidEffect::setPalette(const Palette256& newPalette) {
+    palette = newPalette;
+}
+
+/**
+ * @brief Stops the Effect.
+ * Turns off all LEDs on the display.
+ */
+void FluidEffect::stop() {
+    hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+}
@@ -10,23 +10,19 @@
 
 #include "../../include/effects/FunkyEffect.h"
 #include "../../include/Config.h"
+#include "../../include/utils/FixedMath.h"
 
 /**
  * @brief Constructor for FunkyEffect.
  */
-FunkyEffect::FunkyEffect() : time(0.0) {
-    // New color palette
-    colors[0] = 0x008080;  // Teal
-    colors[1] = 0xa4debf;  // Mint
-    colors[2] = 0xef0041;  // Magenta
-    colors[3] = 0xffe33d;  // Yellow
-    colors[4] = 0xff5bd7;  // Pink
-}
+FunkyEffect::FunkyEffect() : phase(0) {}
 
 /**
  * @brief Initializes the Effect.
+ * Expands the funky palette.
  */
 void FunkyEffect::start() {
+    palette.load(Palette256::FUNKY);
     hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
 }
 
@@ -35,19 +31,22 @@ void FunkyEffect::start() {
  */
 void FunkyEffect::update() {
     // Algorithm to dynamically change the position and color of each LED
+    uint16_t angle = phase;
     for (int i = 0; i < hoop.getActivePixels(); i++) {
-        // Calculate position and color based on time and current position
-        auto position = static_cast<float>(sin((time + i) * 0.1) * 0.5 + 0.5);  // Example of sine function
-        int hue = static_cast<int>((position + 1.0f) * 127.5f);
-        uint32_t color = EffectUtils::HSVtoRGB(hue, 255, 255);
-        uint8_t r = (color >> 16) & 0xFF;
-        uint8_t g = (color >> 8) & 0xFF;
-        uint8_t b = color & 0xFF;
-        hoop.setPixelColor(i, r, g, b);
+        // Sweep the whole palette along a sine advancing 0.1 radians per pixel
+        hoop.setPixelColor(i, palette[128 + (FixedMath::sin16(angle) >> 8)]);
+        angle += ANGLE_STEP;
     }
 
     hoop.show();
-    time++;
+    phase += ANGLE_STEP;
+}
+
+/**
+ * @brief Replaces the palette of the Effect.
+ */
+void FunkyEffect::setPalette(const Palette256& newPalette) {
+    palette = newPalette;
 }
 
 /**
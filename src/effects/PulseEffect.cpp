@@ -11,22 +11,19 @@
 #include "../../include/effects/PulseEffect.h"
 #include "../../include/Config.h"
 #include "../../include/utils/EffectUtils.h"
+#include "../../include/utils/ColorKernels.h"
 
 /**
  * @brief Constructor for PulseEffect.
  */
-PulseEffect::PulseEffect() : pulseSpeed(1), pulseBrightness(255), pulseIncrement(5), currentColorIndex(0) {
-    colors[0] = Adafruit_NeoPixel::Color(34, 87, 122);   // Deep blue reminiscent of tranquil ocean waves
-    colors[1] = Adafruit_NeoPixel::Color(56, 163, 165);  // Subtle greenish-blue representing serene depths
-    colors[2] = Adafruit_NeoPixel::Color(87, 204, 153);  // Vibrant emerald portraying energy and vitality
-    colors[3] = Adafruit_NeoPixel::Color(128, 237, 153); // Fresh light green symbolizing renewal and growth
-    colors[4] = Adafruit_NeoPixel::Color(199, 249, 204); // Soft tea green evoking a sense of calm and balance
-}
+PulseEffect::PulseEffect() : pulseSpeed(1), pulseBrightness(255), pulseIncrement(5), currentColorIndex(0) {}
 
 /**
  * @brief Initializes the Effect.
+ * Expands the ocean palette.
  */
 void PulseEffect::start() {
+    palette.load(Palette256::OCEAN);
 }
 
 /**
@@ -40,24 +37,25 @@ void PulseEffect::update() {
     auto mappedInclination = static_cast<int>(EffectUtils::mapRange(static_cast<int>(inclination), 0, 360, 0, 255));
 
     // Calculate the current color index based on inclination
-    currentColorIndex = mappedInclination / 51;
+    currentColorIndex = mappedInclination / 51 % 5;
 
     // Calculate the current brightness based on inclination
     pulseBrightness = mappedInclination % 51 * 5;
 
-    // Apply the pulse to all LEDs
-    for (int i = 0; i < hoop.getActivePixels(); i++) {
-        uint32_t color = EffectUtils::interpolateColor(colors[currentColorIndex], colors[(currentColorIndex + 1) % 5], i, hoop.getActivePixels());
-        color = EffectUtils::applyBrightness(color, pulseBrightness);
-        uint8_t r = (color >> 16) & 0xFF;
-        uint8_t g = (color >> 8) & 0xFF;
-        uint8_t b = color & 0xFF;
-        hoop.setPixelColor(i, r, g, b);
-    }
+    // Run through the current fifth of the palette, then apply the pulse to the whole frame at once
+    palette.fill(hoop.getFrame(), hoop.getActivePixels(), (currentColorIndex * 51) << 8, (51 << 8) / hoop.getActivePixels(), true);
+    ColorKernels::scale(hoop.getFrame(), hoop.getActivePixels(), pulseBrightness);
 
     hoop.show();
 }
 
+/**
+ * @brief Replaces the palette of the Effect.
+ */
+void PulseEffect::setPalette(const Palette256& newPalette) {
+    palette = newPalette;
+}
+
 /**
  * @brief Stops the Effect.
  * Turns off all LEDs on the display.
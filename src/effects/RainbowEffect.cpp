@@ -9,7 +9,7 @@
  */
 
 #include "../../include/effects/RainbowEffect.h"
-#include "../../include/utils/EffectUtils.h"
+#include "../../include/utils/ColorTables.h"
 #include "../../include/Config.h"
 
 /**
@@ -27,19 +27,10 @@ void RainbowEffect::start() {
  * @brief Updates the Effect.
  */
 void RainbowEffect::update() {
-    static constexpr uint8_t maxHueValue = 255;
-    static uint16_t i = 0;
-
-    for (int j = 0; j < hoop.getActivePixels(); j++) {
-        uint32_t color = EffectUtils::Wheel((i + j) % maxHueValue);
-        uint8_t r = (color >> 16) & 0xFF;
-        uint8_t g = (color >> 8) & 0xFF;
-        uint8_t b = color & 0xFF;
-        hoop.setPixelColor(j, r, g, b);
-    }
+    ColorTables::fillWheelGradient(hoop.getFrame(), hoop.getActivePixels(), hue << 8, 1 << 8);
 
     hoop.show();
-    i++;
+    hue = (hue + 1) % 256;
 }
 
 /**
@@ -12,10 +12,11 @@
 
 /**
  * @brief Constructor for RastafaraiFlagEffect.
- * Initializes angle, angular speed, color offset, and flag colors.
+ * Initializes angle, angular speed, color offset, and flag colors. The speed and offset are 0.02 and 0.1 radians as
+ * 16-bit angles.
  */
 RastafaraiFlagEffect::RastafaraiFlagEffect()
-    : angle(0.0f), angularSpeed(0.02f), colorOffset(0.1f), color1(0xFF0000), color2(0xFFFF00), color3(0x00FF00), numLeds(NUM_LEDS) {}
+    : angle(0), angularSpeed(209), colorOffset(1043), color1(255, 0, 0), color2(255, 255, 0), color3(0, 255, 0) {}
 
 /**
  * @brief Start the RastafaraiFlagEffect.
@@ -30,34 +31,23 @@ void RastafaraiFlagEffect::start() {
  */
 void RastafaraiFlagEffect::update() {
     // Update position and color of each LED
-    for (int i = 0; i < numLeds; i++) {
-        auto portion = static_cast<float>(fmod((angle + static_cast<float>(i) * colorOffset) / (2 * PI), 1.0f));
-
-        if (portion < 0.333f) {
-            // 33.3% green
-            uint8_t r = (color1 >> 16) & 0xFF;
-            uint8_t g = (color1 >> 8) & 0xFF;
-            uint8_t b = color1 & 0xFF;
-            hoop.setPixelColor(i, r, g, b);
-        } else if (portion < 0.667f) {
-            // 33.3% yellow
-            uint8_t r = (color2 >> 16) & 0xFF;
-            uint8_t g = (color2 >> 8) & 0xFF;
-            uint8_t b = color2 & 0xFF;
-            hoop.setPixelColor(i, r, g, b);
-        } else if (portion < 1.0f) {
+    // The 16-bit angle wraps around on its own, so its value is directly the portion of the turn
+    uint16_t portion = angle;
+    for (int i = 0; i < hoop.getActivePixels(); i++) {
+        if (portion < THIRD_TURN) {
             // 33.3% red
-            uint8_t r = (color3 >> 16) & 0xFF;
-            uint8_t g = (color3 >> 8) & 0xFF;
-            uint8_t b = color3 & 0xFF;
-            hoop.setPixelColor(i, r, g, b);
+            hoop.setPixelColor(i, color1);
+        } else if (portion < 2 * THIRD_TURN) {
+            // 33.3% yellow
+            hoop.setPixelColor(i, color2);
+        } else {
+            // 33.3% green
+            hoop.setPixelColor(i, color3);
         }
+        portion += colorOffset;
     }
 
     angle += angularSpeed;
-    if (angle >= 2 * PI) {
-        angle -= 2 * PI;
-    }
 
     hoop.show();
 }
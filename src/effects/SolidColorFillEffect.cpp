@@ -14,7 +14,7 @@
 /**
  * @brief Constructor for SolidColorFillEffect.
  */
-SolidColorFillEffect::SolidColorFillEffect(uint32_t color) : solidColor(color) {
+SolidColorFillEffect::SolidColorFillEffect(RgbColor color) : solidColor(color) {
 }
 
 /**
@@ -23,10 +23,7 @@ SolidColorFillEffect::SolidColorFillEffect(uint32_t color) : solidColor(color) {
 void SolidColorFillEffect::start() {
     // Fill all LEDs with the specified solid color
     for (int i = 0; i < hoop.numPixels(); i++) {
-        uint8_t r = (solidColor >> 16) & 0xFF;
-        uint8_t g = (solidColor >> 8) & 0xFF;
-        uint8_t b = solidColor & 0xFF;
-        hoop.setPixelColor(i, r, g, b);
+        hoop.setPixelColor(i, solidColor);
     }
     hoop.show();
 }
@@ -0,0 +1,73 @@
+/**
+ * @project OpenHoop
+ * @file SparksEffect.cpp
+ * @brief Implementation file for the SparksEffect class, representing an LED effect of sparks sliding around the hoop.
+ * @details Defines the methods to start, update, and stop the sparks effect. Each frame reads the gravity, throws new
+ * sparks from the top of the hoop, moves the sparks and draws them over the faded previous frame.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/effects/SparksEffect.h"
+#include "../../include/Config.h"
+#include "../../include/utils/ColorKernels.h"
+#include "../../include/utils/EffectUtils.h"
+#include "../../include/utils/FixedMath.h"
+
+/**
+ * @brief Constructor for SparksEffect.
+ * Gravity starts pointing at pixel 0 until the accelerometer is read.
+ */
+SparksEffect::SparksEffect(uint32_t seed)
+    : emitRate(3), decay(2), gravityX(4096), gravityY(0), sparkRandom(seed) {}
+
+/**
+ * @brief Initializes the Effect.
+ * Clears the sparks and expands the heat palette.
+ */
+void SparksEffect::start() {
+    sparks.clear();
+    palette.load(Palette256::HEAT);
+    hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+}
+
+/**
+ * @brief Updates the Effect.
+ */
+void SparksEffect::update() {
+    EffectUtils::getGravity(gravityX, gravityY);
+
+    // Throw the sparks both ways from the top of the hoop, opposite to gravity
+    const uint16_t top = FixedMath::atan2(gravityY, gravityX) + FixedMath::HALF_TURN;
+    for (uint8_t i = 0; i < emitRate; i++) {
+        const auto velocity = static_cast<int16_t>(sparkRandom.random16(9600) - 4800);
+        const uint8_t life = sparkRandom.random8(96, 256);
+        sparks.spawn(static_cast<uint16_t>(top + sparkRandom.random8() - 128), velocity, life, palette[sparkRandom.random8(160, 256)]);
+    }
+    sparks.update(gravityX, gravityY, decay);
+
+    // Leave a fading trail behind the sparks
+    RgbColor* frame = hoop.getFrame();
+    const uint16_t pixels = hoop.getActivePixels();
+    ColorKernels::fadeToBlack(frame, pixels, 64);
+    sparks.render(frame, pixels);
+
+    hoop.show();
+}
+
+/**
+ * @brief Replaces the palette of the Effect.
+ */
+void SparksEffect::setPalette(const Palette256& newPalette) {
+    palette = newPalette;
+}
+
+/**
+ * @brief Stops the Effect.
+ * Turns off all LEDs on the display.
+ */
+void SparksEffect::stop() {
+    sparks.clear();
+    hoop.fill(Adafruit_NeoPixel::Color(0, 0, 0));
+}
@@ -11,6 +11,7 @@
 #include "../../include/effects/SpectrumEffect.h"
 #include "../../include/Config.h"
 #include "../../include/utils/EffectUtils.h"
+#include "../../include/utils/FixedMath.h"
 #include <PDM.h>
 
 /**
@@ -34,29 +35,24 @@ void SpectrumEffect::update() {
     // Calculate the color of the sound wave
     int waveBlueComponent = constrain(hue * 2, 0, 255);
     int waveGreenComponent = constrain(hue, 0, 255);
-    int waveEffect = static_cast<int>(sin(radians(wavePosition)) * 127 + 128);
-    uint32_t waveColor = Adafruit_NeoPixel::Color(0, waveGreenComponent + waveEffect, waveBlueComponent);
+    // The wave position is in degrees, 182 being 65536 / 360
+    int waveEffect = ((FixedMath::sin16(static_cast<uint16_t>(wavePosition * 182)) * 127) >> 15) + 128;
+    RgbColor waveColor(0, waveGreenComponent + waveEffect, waveBlueComponent);
 
     // Calculate the inverted color for the hoop background
-    uint32_t invertedBackgroundColor = Adafruit_NeoPixel::Color(255 - (waveGreenComponent + waveEffect), 255 - waveBlueComponent, 255 - waveGreenComponent);
+    RgbColor invertedBackgroundColor(255 - (waveGreenComponent + waveEffect), 255 - waveBlueComponent, 255 - waveGreenComponent);
 
     // Calculate the number of active pixels based on the sound percentage
     int activePixels = EffectUtils::mapRange(soundIntensity, 1, 10, 1, hoop.getActivePixels());
 
     // Apply the inverted background color to all LEDs
     for (int i = 0; i < hoop.getActivePixels(); i++) {
-        uint8_t r = (invertedBackgroundColor >> 16) & 0xFF;
-        uint8_t g = (invertedBackgroundColor >> 8) & 0xFF;
-        uint8_t b = invertedBackgroundColor & 0xFF;
-        hoop.setPixelColor(i, r, g, b);
+        hoop.setPixelColor(i, invertedBackgroundColor);
     }
 
     // Apply the wave color to the active pixels
     for (int i = 0; i < activePixels; i++) {
-        uint8_t r = (waveColor >> 16) & 0xFF;
-        uint8_t g = (waveColor >> 8) & 0xFF;
-        uint8_t b = waveColor & 0xFF;
-        hoop.setPixelColor(i, r, g, b);
+        hoop.setPixelColor(i, waveColor);
     }
 
     hoop.show();
@@ -2,311 +2,31 @@
  * @project OpenHoop
  * @file CupcakeImage.cpp
  * @brief Source file for the CupcakeImage class, representing an image of a cupcake.
- * @details Implements the methods to set colors for the cupcake image.
+ * @details Run-length encodes the cupcake image into flash and passes its colors to RleImage.
  * @author github.com/angelcamelot
  * @date 2024-04-02
  * @license Open-source license.
  */
 
 #include "../../include/images/CupcakeImage.h"
+#include "../../include/images/CupcakePixels.h"
 
-CupcakeImage::CupcakeImage(LedColor color) : LedImage(21, 22) {
-    setColors(color);
-}
+namespace {
 
 /**
- * @brief Sets the colors for the cupcake image.
- * @param color Color to set for the cupcake.
+ * @brief Pixels encoded as runs, the only copy kept in flash. The large areas of frosting and cake make the runs smaller
+ * than the pixels packed at 4 bits each.
  */
-void CupcakeImage::setColors(LedColor color) {
-    setPixel(13, 0, {253, 252, 248});
-    setPixel(5, 1, {43, 43, 43});
-    setPixel(6, 1, {43, 43, 43});
-    setPixel(7, 1, {43, 43, 43});
-    setPixel(13, 1, {253, 252, 248});
-    setPixel(4, 2, {43, 43, 43});
-    setPixel(5, 2, {178, 33, 29});
-    setPixel(6, 2, {178, 33, 29});
-    setPixel(7, 2, {178, 33, 29});
-    setPixel(8, 2, {43, 43, 43});
-    setPixel(13, 2, {253, 252, 248});
-    setPixel(3, 3, {43, 43, 43});
-    setPixel(4, 3, {178, 33, 29});
-    setPixel(5, 3, {253, 252, 248});
-    setPixel(6, 3, {178, 33, 29});
-    setPixel(7, 3, {178, 33, 29});
-    setPixel(8, 3, {178, 33, 29});
-    setPixel(9, 3, {43, 43, 43});
-    setPixel(13, 3, {253, 252, 248});
-    setPixel(3, 4, {43, 43, 43});
-    setPixel(4, 4, {178, 33, 29});
-    setPixel(6, 4, {178, 33, 29});
-    setPixel(7, 4, {178, 33, 29});
-    setPixel(8, 4, {178, 33, 29});
-    setPixel(9, 4, {43, 43, 43});
-    setPixel(10, 4, {43, 43, 43});
-    setPixel(11, 4, {43, 43, 43});
-    setPixel(12, 4, {43, 43, 43});
-    setPixel(3, 5, {43, 43, 43});
-    setPixel(4, 5, {178, 33, 29});
-    setPixel(5, 5, {178, 33, 29});
-    setPixel(6, 5, {178, 33, 29});
-    setPixel(7, 5, {178, 33, 29});
-    setPixel(8, 5, {178, 33, 29});
-    setPixel(9, 5, {43, 43, 43});
-    setPixel(10, 5, color);
-    setPixel(11, 5, color);
-    setPixel(12, 5, color);
-    setPixel(13, 5, {43, 43, 43});
-    setPixel(14, 5, {43, 43, 43});
-    setPixel(4, 6, {43, 43, 43});
-    setPixel(5, 6, {178, 33, 29});
-    setPixel(6, 6, {178, 33, 29});
-    setPixel(7, 6, {178, 33, 29});
-    setPixel(8, 6, {43, 43, 43});
-    setPixel(9, 6, color);
-    setPixel(10, 6, color);
-    setPixel(11, 6, {182, 85, 214});
-    setPixel(12, 6, color);
-    setPixel(13, 6, color);
-    setPixel(14, 6, color);
-    setPixel(15, 6, {43, 43, 43});
-    setPixel(16, 6, {43, 43, 43});
-    setPixel(3, 7, {43, 43, 43});
-    setPixel(4, 7, color);
-    setPixel(5, 7, {43, 43, 43});
-    setPixel(6, 7, {43, 43, 43});
-    setPixel(7, 7, {43, 43, 43});
-    setPixel(8, 7, color);
-    setPixel(9, 7, color);
-    setPixel(10, 7, color);
-    setPixel(11, 7, color);
-    setPixel(12, 7, color);
-    setPixel(13, 7, color);
-    setPixel(14, 7, {253, 218, 78});
-    setPixel(15, 7, color);
-    setPixel(16, 7, color);
-    setPixel(17, 7, {43, 43, 43});
-    setPixel(3, 8, {43, 43, 43});
-    setPixel(4, 8, color);
-    setPixel(5, 8, color);
-    setPixel(6, 8, color);
-    setPixel(7, 8, {249, 77, 132});
-    setPixel(8, 8, color);
-    setPixel(9, 8, color);
-    setPixel(10, 8, color);
-    setPixel(11, 8, color);
-    setPixel(12, 8, {105, 254, 128});
-    setPixel(13, 8, color);
-    setPixel(14, 8, color);
-    setPixel(15, 8, color);
-    setPixel(16, 8, color);
-    setPixel(17, 8, {43, 43, 43});
-    setPixel(18, 8, {253, 252, 248});
-    setPixel(2, 9, {43, 43, 43});
-    setPixel(3, 9, color);
-    setPixel(4, 9, color);
-    setPixel(5, 9, color);
-    setPixel(6, 9, color);
-    setPixel(7, 9, color);
-    setPixel(8, 9, color);
-    setPixel(9, 9, color);
-    setPixel(10, 9, color);
-    setPixel(11, 9, color);
-    setPixel(12, 9, color);
-    setPixel(13, 9, color);
-    setPixel(14, 9, color);
-    setPixel(15, 9, {249, 77, 132});
-    setPixel(16, 9, color);
-    setPixel(17, 9, color);
-    setPixel(18, 9, {43, 43, 43});
-    setPixel(2, 10, {43, 43, 43});
-    setPixel(3, 10, color);
-    setPixel(4, 10, color);
-    setPixel(5, 10, {105, 254, 128});
-    setPixel(6, 10, color);
-    setPixel(7, 10, color);
-    setPixel(8, 10, color);
-    setPixel(9, 10, {253, 218, 78});
-    setPixel(10, 10, color);
-    setPixel(11, 10, color);
-    setPixel(12, 10, color);
-    setPixel(13, 10, color);
-    setPixel(14, 10, color);
-    setPixel(15, 10, color);
-    setPixel(16, 10, color);
-    setPixel(17, 10, color);
-    setPixel(18, 10, {43, 43, 43});
-    setPixel(1, 11, {43, 43, 43});
-    setPixel(2, 11, color);
-    setPixel(3, 11, color);
-    setPixel(4, 11, color);
-    setPixel(5, 11, color);
-    setPixel(6, 11, color);
-    setPixel(7, 11, {110, 190, 250});
-    setPixel(8, 11, color);
-    setPixel(9, 11, color);
-    setPixel(10, 11, color);
-    setPixel(11, 11, color);
-    setPixel(12, 11, color);
-    setPixel(13, 11, {182, 85, 214});
-    setPixel(14, 11, color);
-    setPixel(15, 11, color);
-    setPixel(16, 11, {110, 190, 250});
-    setPixel(17, 11, color);
-    setPixel(18, 11, color);
-    setPixel(19, 11, {43, 43, 43});
-    setPixel(1, 12, {43, 43, 43});
-    setPixel(2, 12, color);
-    setPixel(3, 12, color);
-    setPixel(4, 12, color);
-    setPixel(5, 12, color);
-    setPixel(6, 12, color);
-    setPixel(7, 12, color);
-    setPixel(8, 12, color);
-    setPixel(9, 12, color);
-    setPixel(10, 12, {105, 254, 128});
-    setPixel(11, 12, color);
-    setPixel(12, 12, color);
-    setPixel(13, 12, color);
-    setPixel(14, 12, color);
-    setPixel(15, 12, color);
-    setPixel(16, 12, color);
-    setPixel(17, 12, color);
-    setPixel(18, 12, color);
-    setPixel(19, 12, {43, 43, 43});
-    setPixel(1, 13, {43, 43, 43});
-    setPixel(2, 13, color);
-    setPixel(3, 13, color);
-    setPixel(4, 13, color);
-    setPixel(5, 13, color);
-    setPixel(6, 13, color);
-    setPixel(7, 13, color);
-    setPixel(8, 13, color);
-    setPixel(9, 13, color);
-    setPixel(10, 13, color);
-    setPixel(11, 13, color);
-    setPixel(12, 13, color);
-    setPixel(13, 13, color);
-    setPixel(14, 13, color);
-    setPixel(15, 13, color);
-    setPixel(16, 13, color);
-    setPixel(17, 13, color);
-    setPixel(18, 13, color);
-    setPixel(19, 13, {43, 43, 43});
-    setPixel(2, 14, {43, 43, 43});
-    setPixel(3, 14, {43, 43, 43});
-    setPixel(4, 14, {43, 43, 43});
-    setPixel(5, 14, {43, 43, 43});
-    setPixel(6, 14, color);
-    setPixel(7, 14, color);
-    setPixel(8, 14, color);
-    setPixel(9, 14, color);
-    setPixel(10, 14, {43, 43, 43});
-    setPixel(11, 14, color);
-    setPixel(12, 14, color);
-    setPixel(13, 14, color);
-    setPixel(14, 14, color);
-    setPixel(15, 14, color);
-    setPixel(16, 14, color);
-    setPixel(17, 14, {43, 43, 43});
-    setPixel(18, 14, {43, 43, 43});
-    setPixel(3, 15, {43, 43, 43});
-    setPixel(4, 15, {137, 68, 18});
-    setPixel(5, 15, {137, 68, 18});
-    setPixel(6, 15, {43, 43, 43});
-    setPixel(7, 15, color);
-    setPixel(8, 15, color);
-    setPixel(9, 15, {43, 43, 43});
-    setPixel(10, 15, {137, 68, 18});
-    setPixel(11, 15, {43, 43, 43});
-    setPixel(12, 15, color);
-    setPixel(13, 15, color);
-    setPixel(14, 15, color);
-    setPixel(15, 15, color);
-    setPixel(16, 15, {43, 43, 43});
-    setPixel(17, 15, {43, 43, 43});
-    setPixel(18, 15, {253, 252, 248});
-    setPixel(20, 15, {253, 252, 248});
-    setPixel(3, 16, {43, 43, 43});
-    setPixel(4, 16, {137, 68, 18});
-    setPixel(5, 16, {137, 68, 18});
-    setPixel(6, 16, {137, 68, 18});
-    setPixel(7, 16, {43, 43, 43});
-    setPixel(8, 16, {43, 43, 43});
-    setPixel(9, 16, {137, 68, 18});
-    setPixel(10, 16, {137, 68, 18});
-    setPixel(11, 16, {137, 68, 18});
-    setPixel(12, 16, {43, 43, 43});
-    setPixel(13, 16, color);
-    setPixel(14, 16, color);
-    setPixel(15, 16, {43, 43, 43});
-    setPixel(16, 16, {137, 68, 18});
-    setPixel(17, 16, {43, 43, 43});
-    setPixel(20, 16, {253, 252, 248});
-    setPixel(4, 17, {43, 43, 43});
-    setPixel(5, 17, {137, 68, 18});
-    setPixel(6, 17, {137, 68, 18});
-    setPixel(7, 17, {137, 68, 18});
-    setPixel(8, 17, {137, 68, 18});
-    setPixel(9, 17, {137, 68, 18});
-    setPixel(10, 17, {137, 68, 18});
-    setPixel(11, 17, {137, 68, 18});
-    setPixel(12, 17, {137, 68, 18});
-    setPixel(13, 17, {43, 43, 43});
-    setPixel(14, 17, {43, 43, 43});
-    setPixel(15, 17, {137, 68, 18});
-    setPixel(16, 17, {43, 43, 43});
-    setPixel(4, 18, {43, 43, 43});
-    setPixel(5, 18, {137, 68, 18});
-    setPixel(6, 18, {137, 68, 18});
-    setPixel(7, 18, {137, 68, 18});
-    setPixel(8, 18, {137, 68, 18});
-    setPixel(9, 18, {137, 68, 18});
-    setPixel(10, 18, {137, 68, 18});
-    setPixel(11, 18, {137, 68, 18});
-    setPixel(12, 18, {137, 68, 18});
-    setPixel(13, 18, {137, 68, 18});
-    setPixel(14, 18, {137, 68, 18});
-    setPixel(15, 18, {137, 68, 18});
-    setPixel(16, 18, {43, 43, 43});
-    setPixel(18, 18, {253, 252, 248});
-    setPixel(20, 18, {253, 252, 248});
-    setPixel(4, 19, {43, 43, 43});
-    setPixel(5, 19, {137, 68, 18});
-    setPixel(6, 19, {137, 68, 18});
-    setPixel(7, 19, {137, 68, 18});
-    setPixel(8, 19, {137, 68, 18});
-    setPixel(9, 19, {137, 68, 18});
-    setPixel(10, 19, {137, 68, 18});
-    setPixel(11, 19, {137, 68, 18});
-    setPixel(12, 19, {137, 68, 18});
-    setPixel(13, 19, {137, 68, 18});
-    setPixel(14, 19, {137, 68, 18});
-    setPixel(15, 19, {137, 68, 18});
-    setPixel(16, 19, {43, 43, 43});
-    setPixel(5, 20, {43, 43, 43});
-    setPixel(6, 20, {137, 68, 18});
-    setPixel(7, 20, {137, 68, 18});
-    setPixel(8, 20, {137, 68, 18});
-    setPixel(9, 20, {137, 68, 18});
-    setPixel(10, 20, {137, 68, 18});
-    setPixel(11, 20, {137, 68, 18});
-    setPixel(12, 20, {137, 68, 18});
-    setPixel(13, 20, {137, 68, 18});
-    setPixel(14, 20, {137, 68, 18});
-    setPixel(15, 20, {43, 43, 43});
-    setPixel(16, 20, {253, 252, 248});
-    setPixel(18, 20, {253, 252, 248});
-    setPixel(20, 20, {253, 252, 248});
-    setPixel(6, 21, {43, 43, 43});
-    setPixel(7, 21, {43, 43, 43});
-    setPixel(8, 21, {43, 43, 43});
-    setPixel(9, 21, {43, 43, 43});
-    setPixel(10, 21, {43, 43, 43});
-    setPixel(11, 21, {43, 43, 43});
-    setPixel(12, 21, {43, 43, 43});
-    setPixel(13, 21, {43, 43, 43});
-    setPixel(14, 21, {43, 43, 43});
-    setPixel(15, 21, {253, 252, 248});
+constexpr auto RLE = encodeRuns<countRuns(CupcakePixels::PIXELS)>(CupcakePixels::PIXELS);
+
 }
+
+/**
+ * @brief Constructor for CupcakeImage.
+ * The palette entries follow the indices of the pixel table.
+ */
+CupcakeImage::CupcakeImage(LedColor color)
+    : RleImage(CupcakePixels::WIDTH, CupcakePixels::HEIGHT, 1, RLE.offsets, RLE.runs,
+               {LedColor(), color, LedColor(253, 252, 248), LedColor(43, 43, 43), LedColor(178, 33, 29),
+                LedColor(182, 85, 214), LedColor(253, 218, 78), LedColor(249, 77, 132), LedColor(105, 254, 128),
+                LedColor(110, 190, 250), LedColor(137, 68, 18)}) {}
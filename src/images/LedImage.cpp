@@ -1,8 +1,8 @@
 /**
  * @project OpenHoop
  * @file LedImage.cpp
- * @brief Source file for the LedImage class, an abstract base class representing an image composed of LEDs.
- * @details Implements the methods to set and get pixel colors, as well as checking the validity of pixel coordinates.
+ * @brief Source file for the LedImage class, an image composed of LEDs and the base of the shipped images.
+ * @details Implements the methods to look pixel colors up in the image palette, as well as checking the validity of pixel coordinates.
  * @author github.com/angelcamelot
  * @date 2024-04-07
  * @license Open-source license.
@@ -11,47 +11,59 @@
 #include "../../include/images/LedImage.h"
 #include <algorithm> // For std::fill
 
+constexpr uint8_t LedImage::MAX_COLORS;
+constexpr int LedImage::MAX_HEIGHT;
+
 /**
  * @brief Constructor for the LedImage class.
  * @param w Width of the image.
  * @param h Height of the image.
+ * @param bits Bits per pixel of the packed indices.
+ * @param packedIndices Palette indices as packed by packPixels.
+ * @param colors Palette entries.
  */
-LedImage::LedImage(int w, int h) : width(w), height(h) {
-    // Initialize the pixel array with a fully transparent color
-    pixels = new LedColor[width * height];
-    std::fill(pixels, pixels + (width * height), LedColor(0, 0, 0, 0));
+LedImage::LedImage(int w, int h, uint8_t bits, const uint8_t* packedIndices, std::initializer_list<LedColor> colors)
+    : width(w), height(h), indices(packedIndices), bitsPerPixel(bits) {
+    uint8_t index = 0;
+    for (const LedColor& color : colors) {
+        if (index == MAX_COLORS) {
+            break;
+        }
+        palette[index++] = color;
+    }
 }
 
 /**
- * @brief Destructor for the LedImage class.
+ * @brief Constructor for images stored in another format than packed indices.
+ * @param w Width of the image.
+ * @param h Height of the image.
+ * @param colors Palette entries.
  */
-LedImage::~LedImage() {
-    delete[] pixels;
-}
+LedImage::LedImage(int w, int h, std::initializer_list<LedColor> colors) : LedImage(w, h, 8, nullptr, colors) {}
 
 /**
- * @brief Set the color of a pixel at a specific position.
+ * @brief Get the color of a pixel at a specific position.
  * @param x X-coordinate of the pixel.
  * @param y Y-coordinate of the pixel.
- * @param color Color to set.
+ * @return Color of the pixel.
  */
-void LedImage::setPixel(int x, int y, const LedColor& color) {
+LedColor LedImage::getPixel(int x, const int y) const {
     if (isValidIndex(x, y)) {
-        pixels[y * width + x] = color;
+        return decodePixel(x, y);
     }
+    return {0, 0, 0, 0}; // Return fully transparent color for out-of-bounds pixels
 }
 
 /**
- * @brief Get the color of a pixel at a specific position.
+ * @brief Decode the color of a pixel from the packed palette indices.
  * @param x X-coordinate of the pixel.
  * @param y Y-coordinate of the pixel.
  * @return Color of the pixel.
  */
-LedColor LedImage::getPixel(int x, const int y) const {
-    if (isValidIndex(x, y)) {
-        return pixels[y * width + x];
-    }
-    return {0, 0, 0, 0}; // Return fully transparent color for out-of-bounds pixels
+LedColor LedImage::decodePixel(int x, int y) const {
+    const uint32_t bit = static_cast<uint32_t>(x * height + y) * bitsPerPixel;
+    const uint8_t index = (indices[bit / 8] >> (bit % 8)) & ((1 << bitsPerPixel) - 1);
+    return palette[index % MAX_COLORS];
 }
 
 /**
@@ -63,3 +75,53 @@ LedColor LedImage::getPixel(int x, const int y) const {
 bool LedImage::isValidIndex(int x, int y) const {
     return x >= 0 && x < width && y >= 0 && y < height;
 }
+
+/**
+ * @brief Replace a palette entry.
+ * @param index Palette index.
+ * @param color New color of the entry.
+ */
+void LedImage::setPaletteColor(uint8_t index, const LedColor& color) {
+    if (index < MAX_COLORS) {
+        palette[index] = color;
+    }
+}
+
+/**
+ * @brief Get the colors of a column.
+ * @param x X-coordinate of the column.
+ * @return Colors of the column.
+ */
+LedColumn LedImage::column(int x) {
+    const int count = height < MAX_HEIGHT ? height : MAX_HEIGHT;
+    if (x >= 0 && x < width) {
+        decodeColumn(x, columnBuffer, count);
+    } else {
+        std::fill(columnBuffer, columnBuffer + count, LedColor());
+    }
+    return {columnBuffer, count};
+}
+
+/**
+ * @brief Decode the colors of a column from the packed palette indices.
+ * @details Columns are stored one after the other, so the indices of a column are consecutive bits, walked here a byte
+ * at a time without any per-pixel multiplication.
+ * @param x X-coordinate of the column.
+ * @param pixels Receives the colors of the column.
+ * @param count Number of pixels to decode.
+ */
+void LedImage::decodeColumn(int x, LedColor* pixels, int count) const {
+    const uint32_t firstBit = static_cast<uint32_t>(x * height) * bitsPerPixel;
+    const uint8_t* byte = indices + firstBit / 8;
+    uint8_t shift = firstBit % 8;
+    const uint8_t mask = (1 << bitsPerPixel) - 1;
+
+    for (int y = 0; y < count; y++) {
+        pixels[y] = palette[((*byte >> shift) & mask) % MAX_COLORS];
+        shift += bitsPerPixel;
+        if (shift == 8) {
+            shift = 0;
+            byte++;
+        }
+    }
+}
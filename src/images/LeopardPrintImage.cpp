@@ -2,564 +2,38 @@
  * @project OpenHoop
  * @file LeopardPrintImage.cpp
  * @brief Source file for the LeopardPrintImage class, representing an image of a animal print pattern.
- * @details Implements the methods to set colors for the leopard print pattern image.
+ * @details Packs the leopard print pattern as a table of palette indices into flash and passes its colors to LedImage.
  * @author github.com/angelcamelot
  * @date 2024-04-02
  * @license Open-source license.
  */
 
 #include "../../include/images/LeopardPrintImage.h"
+#include "../../include/images/LeopardPrintPixels.h"
+
+namespace {
+
+/**
+ * @brief Pixels packed at 2 bits each, the only copy kept in flash.
+ */
+constexpr auto PACKED = packPixels<LeopardPrintPixels::BITS>(LeopardPrintPixels::PIXELS);
 
-LeopardPrintImage::LeopardPrintImage(LedColor primary_color, LedColor secondary_color) : LedImage(30, 30) {
-    setPatternColors(primary_color, secondary_color);
 }
 
 /**
- * @brief Sets the colors for the leopard print pattern spots.
+ * @brief Constructor for LeopardPrintImage.
+ * The palette entries follow the indices of the pixel table.
+ */
+LeopardPrintImage::LeopardPrintImage(LedColor primary_color, LedColor secondary_color)
+    : LedImage(LeopardPrintPixels::WIDTH, LeopardPrintPixels::HEIGHT, LeopardPrintPixels::BITS, PACKED.data,
+               {LedColor(), primary_color, secondary_color}) {}
+
+/**
+ * @brief Recolors the leopard print pattern spots by swapping palette entries.
  * @param primary_color The darker color of the leopard spots.
  * @param secondary_color The lighter color of the leopard spots.
  */
 void LeopardPrintImage::setPatternColors(LedColor primary_color, LedColor secondary_color) {
-    setPixel(0, 0, secondary_color);
-    setPixel(1, 0, primary_color);
-    setPixel(4, 0, primary_color);
-    setPixel(5, 0, primary_color);
-    setPixel(7, 0, secondary_color);
-    setPixel(8, 0, secondary_color);
-    setPixel(9, 0, primary_color);
-    setPixel(15, 0, primary_color);
-    setPixel(16, 0, secondary_color);
-    setPixel(17, 0, primary_color);
-    setPixel(20, 0, primary_color);
-    setPixel(21, 0, primary_color);
-    setPixel(24, 0, primary_color);
-    setPixel(25, 0, primary_color);
-    setPixel(28, 0, primary_color);
-    setPixel(29, 0, primary_color);
-    setPixel(0, 1, secondary_color);
-    setPixel(1, 1, primary_color);
-    setPixel(3, 1, primary_color);
-    setPixel(4, 1, secondary_color);
-    setPixel(5, 1, secondary_color);
-    setPixel(8, 1, primary_color);
-    setPixel(13, 1, primary_color);
-    setPixel(14, 1, secondary_color);
-    setPixel(15, 1, primary_color);
-    setPixel(16, 1, secondary_color);
-    setPixel(17, 1, secondary_color);
-    setPixel(18, 1, primary_color);
-    setPixel(24, 1, primary_color);
-    setPixel(25, 1, primary_color);
-    setPixel(0, 2, primary_color);
-    setPixel(3, 2, primary_color);
-    setPixel(4, 2, secondary_color);
-    setPixel(5, 2, secondary_color);
-    setPixel(6, 2, primary_color);
-    setPixel(8, 2, primary_color);
-    setPixel(9, 2, secondary_color);
-    setPixel(10, 2, primary_color);
-    setPixel(12, 2, primary_color);
-    setPixel(13, 2, secondary_color);
-    setPixel(14, 2, secondary_color);
-    setPixel(15, 2, primary_color);
-    setPixel(16, 2, secondary_color);
-    setPixel(17, 2, secondary_color);
-    setPixel(18, 2, primary_color);
-    setPixel(20, 2, primary_color);
-    setPixel(21, 2, primary_color);
-    setPixel(22, 2, secondary_color);
-    setPixel(23, 2, secondary_color);
-    setPixel(24, 2, primary_color);
-    setPixel(27, 2, primary_color);
-    setPixel(28, 2, primary_color);
-    setPixel(29, 2, secondary_color);
-    setPixel(0, 3, primary_color);
-    setPixel(4, 3, primary_color);
-    setPixel(5, 3, secondary_color);
-    setPixel(6, 3, primary_color);
-    setPixel(8, 3, secondary_color);
-    setPixel(9, 3, secondary_color);
-    setPixel(10, 3, secondary_color);
-    setPixel(11, 3, primary_color);
-    setPixel(12, 3, primary_color);
-    setPixel(13, 3, secondary_color);
-    setPixel(14, 3, secondary_color);
-    setPixel(15, 3, primary_color);
-    setPixel(16, 3, secondary_color);
-    setPixel(17, 3, secondary_color);
-    setPixel(18, 3, primary_color);
-    setPixel(19, 3, secondary_color);
-    setPixel(20, 3, secondary_color);
-    setPixel(21, 3, primary_color);
-    setPixel(22, 3, secondary_color);
-    setPixel(23, 3, secondary_color);
-    setPixel(24, 3, secondary_color);
-    setPixel(26, 3, primary_color);
-    setPixel(27, 3, secondary_color);
-    setPixel(28, 3, secondary_color);
-    setPixel(29, 3, secondary_color);
-    setPixel(0, 4, secondary_color);
-    setPixel(1, 4, primary_color);
-    setPixel(5, 4, primary_color);
-    setPixel(8, 4, secondary_color);
-    setPixel(9, 4, secondary_color);
-    setPixel(10, 4, secondary_color);
-    setPixel(11, 4, secondary_color);
-    setPixel(12, 4, primary_color);
-    setPixel(13, 4, secondary_color);
-    setPixel(14, 4, secondary_color);
-    setPixel(15, 4, secondary_color);
-    setPixel(16, 4, secondary_color);
-    setPixel(17, 4, secondary_color);
-    setPixel(18, 4, primary_color);
-    setPixel(19, 4, secondary_color);
-    setPixel(20, 4, secondary_color);
-    setPixel(21, 4, primary_color);
-    setPixel(22, 4, primary_color);
-    setPixel(23, 4, secondary_color);
-    setPixel(24, 4, secondary_color);
-    setPixel(25, 4, primary_color);
-    setPixel(26, 4, secondary_color);
-    setPixel(27, 4, secondary_color);
-    setPixel(28, 4, secondary_color);
-    setPixel(29, 4, secondary_color);
-    setPixel(0, 5, secondary_color);
-    setPixel(1, 5, secondary_color);
-    setPixel(2, 5, secondary_color);
-    setPixel(3, 5, primary_color);
-    setPixel(8, 5, primary_color);
-    setPixel(9, 5, primary_color);
-    setPixel(10, 5, secondary_color);
-    setPixel(11, 5, primary_color);
-    setPixel(12, 5, primary_color);
-    setPixel(14, 5, primary_color);
-    setPixel(15, 5, primary_color);
-    setPixel(16, 5, secondary_color);
-    setPixel(17, 5, primary_color);
-    setPixel(19, 5, primary_color);
-    setPixel(20, 5, secondary_color);
-    setPixel(21, 5, secondary_color);
-    setPixel(22, 5, secondary_color);
-    setPixel(23, 5, secondary_color);
-    setPixel(24, 5, primary_color);
-    setPixel(25, 5, primary_color);
-    setPixel(26, 5, secondary_color);
-    setPixel(27, 5, secondary_color);
-    setPixel(28, 5, secondary_color);
-    setPixel(29, 5, primary_color);
-    setPixel(0, 6, primary_color);
-    setPixel(1, 6, secondary_color);
-    setPixel(2, 6, secondary_color);
-    setPixel(3, 6, primary_color);
-    setPixel(6, 6, primary_color);
-    setPixel(7, 6, primary_color);
-    setPixel(8, 6, primary_color);
-    setPixel(13, 6, primary_color);
-    setPixel(20, 6, primary_color);
-    setPixel(21, 6, primary_color);
-    setPixel(22, 6, primary_color);
-    setPixel(23, 6, primary_color);
-    setPixel(26, 6, primary_color);
-    setPixel(27, 6, primary_color);
-    setPixel(28, 6, primary_color);
-    setPixel(0, 7, primary_color);
-    setPixel(1, 7, secondary_color);
-    setPixel(2, 7, primary_color);
-    setPixel(5, 7, primary_color);
-    setPixel(6, 7, secondary_color);
-    setPixel(7, 7, secondary_color);
-    setPixel(8, 7, secondary_color);
-    setPixel(11, 7, primary_color);
-    setPixel(12, 7, secondary_color);
-    setPixel(13, 7, secondary_color);
-    setPixel(14, 7, secondary_color);
-    setPixel(19, 7, primary_color);
-    setPixel(20, 7, primary_color);
-    setPixel(1, 8, primary_color);
-    setPixel(4, 8, secondary_color);
-    setPixel(5, 8, primary_color);
-    setPixel(6, 8, primary_color);
-    setPixel(7, 8, primary_color);
-    setPixel(8, 8, primary_color);
-    setPixel(11, 8, secondary_color);
-    setPixel(12, 8, secondary_color);
-    setPixel(13, 8, secondary_color);
-    setPixel(14, 8, primary_color);
-    setPixel(15, 8, secondary_color);
-    setPixel(16, 8, secondary_color);
-    setPixel(19, 8, primary_color);
-    setPixel(20, 8, secondary_color);
-    setPixel(21, 8, secondary_color);
-    setPixel(26, 8, primary_color);
-    setPixel(27, 8, primary_color);
-    setPixel(28, 8, primary_color);
-    setPixel(3, 9, primary_color);
-    setPixel(4, 9, secondary_color);
-    setPixel(5, 9, secondary_color);
-    setPixel(6, 9, primary_color);
-    setPixel(7, 9, secondary_color);
-    setPixel(8, 9, primary_color);
-    setPixel(11, 9, secondary_color);
-    setPixel(12, 9, secondary_color);
-    setPixel(13, 9, primary_color);
-    setPixel(14, 9, secondary_color);
-    setPixel(15, 9, secondary_color);
-    setPixel(16, 9, secondary_color);
-    setPixel(17, 9, primary_color);
-    setPixel(20, 9, primary_color);
-    setPixel(21, 9, primary_color);
-    setPixel(23, 9, primary_color);
-    setPixel(24, 9, secondary_color);
-    setPixel(25, 9, secondary_color);
-    setPixel(26, 9, secondary_color);
-    setPixel(27, 9, secondary_color);
-    setPixel(28, 9, secondary_color);
-    setPixel(3, 10, secondary_color);
-    setPixel(4, 10, secondary_color);
-    setPixel(5, 10, primary_color);
-    setPixel(6, 10, secondary_color);
-    setPixel(7, 10, secondary_color);
-    setPixel(8, 10, secondary_color);
-    setPixel(11, 10, primary_color);
-    setPixel(12, 10, primary_color);
-    setPixel(13, 10, primary_color);
-    setPixel(14, 10, secondary_color);
-    setPixel(15, 10, secondary_color);
-    setPixel(16, 10, secondary_color);
-    setPixel(17, 10, primary_color);
-    setPixel(23, 10, secondary_color);
-    setPixel(24, 10, secondary_color);
-    setPixel(25, 10, secondary_color);
-    setPixel(26, 10, primary_color);
-    setPixel(27, 10, secondary_color);
-    setPixel(28, 10, secondary_color);
-    setPixel(3, 11, primary_color);
-    setPixel(4, 11, primary_color);
-    setPixel(6, 11, secondary_color);
-    setPixel(7, 11, secondary_color);
-    setPixel(8, 11, primary_color);
-    setPixel(14, 11, secondary_color);
-    setPixel(15, 11, primary_color);
-    setPixel(18, 11, primary_color);
-    setPixel(19, 11, secondary_color);
-    setPixel(20, 11, secondary_color);
-    setPixel(24, 11, primary_color);
-    setPixel(25, 11, primary_color);
-    setPixel(26, 11, primary_color);
-    setPixel(27, 11, secondary_color);
-    setPixel(28, 11, secondary_color);
-    setPixel(0, 12, secondary_color);
-    setPixel(1, 12, primary_color);
-    setPixel(7, 12, primary_color);
-    setPixel(12, 12, primary_color);
-    setPixel(17, 12, primary_color);
-    setPixel(18, 12, secondary_color);
-    setPixel(19, 12, secondary_color);
-    setPixel(20, 12, secondary_color);
-    setPixel(21, 12, primary_color);
-    setPixel(25, 12, secondary_color);
-    setPixel(26, 12, secondary_color);
-    setPixel(27, 12, secondary_color);
-    setPixel(28, 12, secondary_color);
-    setPixel(29, 12, primary_color);
-    setPixel(0, 13, secondary_color);
-    setPixel(1, 13, primary_color);
-    setPixel(2, 13, primary_color);
-    setPixel(3, 13, secondary_color);
-    setPixel(4, 13, secondary_color);
-    setPixel(9, 13, secondary_color);
-    setPixel(10, 13, secondary_color);
-    setPixel(11, 13, secondary_color);
-    setPixel(12, 13, secondary_color);
-    setPixel(13, 13, secondary_color);
-    setPixel(16, 13, primary_color);
-    setPixel(17, 13, secondary_color);
-    setPixel(18, 13, secondary_color);
-    setPixel(19, 13, primary_color);
-    setPixel(20, 13, primary_color);
-    setPixel(21, 13, primary_color);
-    setPixel(22, 13, secondary_color);
-    setPixel(25, 13, secondary_color);
-    setPixel(26, 13, secondary_color);
-    setPixel(27, 13, secondary_color);
-    setPixel(28, 13, secondary_color);
-    setPixel(29, 13, primary_color);
-    setPixel(0, 14, secondary_color);
-    setPixel(2, 14, primary_color);
-    setPixel(3, 14, secondary_color);
-    setPixel(4, 14, secondary_color);
-    setPixel(5, 14, primary_color);
-    setPixel(8, 14, primary_color);
-    setPixel(9, 14, secondary_color);
-    setPixel(10, 14, secondary_color);
-    setPixel(11, 14, secondary_color);
-    setPixel(12, 14, secondary_color);
-    setPixel(13, 14, primary_color);
-    setPixel(16, 14, primary_color);
-    setPixel(17, 14, secondary_color);
-    setPixel(18, 14, secondary_color);
-    setPixel(19, 14, primary_color);
-    setPixel(20, 14, primary_color);
-    setPixel(21, 14, secondary_color);
-    setPixel(22, 14, secondary_color);
-    setPixel(23, 14, secondary_color);
-    setPixel(0, 15, primary_color);
-    setPixel(2, 15, primary_color);
-    setPixel(3, 15, secondary_color);
-    setPixel(4, 15, secondary_color);
-    setPixel(5, 15, primary_color);
-    setPixel(8, 15, primary_color);
-    setPixel(9, 15, secondary_color);
-    setPixel(10, 15, primary_color);
-    setPixel(11, 15, secondary_color);
-    setPixel(12, 15, primary_color);
-    setPixel(17, 15, primary_color);
-    setPixel(18, 15, secondary_color);
-    setPixel(19, 15, secondary_color);
-    setPixel(20, 15, secondary_color);
-    setPixel(21, 15, secondary_color);
-    setPixel(22, 15, secondary_color);
-    setPixel(23, 15, primary_color);
-    setPixel(28, 15, primary_color);
-    setPixel(29, 15, primary_color);
-    setPixel(4, 16, primary_color);
-    setPixel(7, 16, primary_color);
-    setPixel(8, 16, primary_color);
-    setPixel(14, 16, primary_color);
-    setPixel(18, 16, secondary_color);
-    setPixel(19, 16, secondary_color);
-    setPixel(20, 16, secondary_color);
-    setPixel(21, 16, primary_color);
-    setPixel(28, 16, secondary_color);
-    setPixel(29, 16, secondary_color);
-    setPixel(2, 17, primary_color);
-    setPixel(3, 17, primary_color);
-    setPixel(6, 17, primary_color);
-    setPixel(7, 17, secondary_color);
-    setPixel(8, 17, secondary_color);
-    setPixel(13, 17, secondary_color);
-    setPixel(14, 17, secondary_color);
-    setPixel(15, 17, primary_color);
-    setPixel(18, 17, primary_color);
-    setPixel(19, 17, primary_color);
-    setPixel(20, 17, primary_color);
-    setPixel(24, 17, primary_color);
-    setPixel(28, 17, secondary_color);
-    setPixel(29, 17, secondary_color);
-    setPixel(1, 18, primary_color);
-    setPixel(2, 18, secondary_color);
-    setPixel(3, 18, secondary_color);
-    setPixel(4, 18, primary_color);
-    setPixel(6, 18, primary_color);
-    setPixel(7, 18, secondary_color);
-    setPixel(8, 18, secondary_color);
-    setPixel(9, 18, secondary_color);
-    setPixel(13, 18, secondary_color);
-    setPixel(14, 18, secondary_color);
-    setPixel(15, 18, primary_color);
-    setPixel(16, 18, secondary_color);
-    setPixel(23, 18, secondary_color);
-    setPixel(24, 18, secondary_color);
-    setPixel(25, 18, secondary_color);
-    setPixel(26, 18, primary_color);
-    setPixel(28, 18, primary_color);
-    setPixel(29, 18, secondary_color);
-    setPixel(0, 19, primary_color);
-    setPixel(1, 19, secondary_color);
-    setPixel(2, 19, secondary_color);
-    setPixel(3, 19, secondary_color);
-    setPixel(4, 19, primary_color);
-    setPixel(7, 19, secondary_color);
-    setPixel(8, 19, secondary_color);
-    setPixel(9, 19, secondary_color);
-    setPixel(13, 19, primary_color);
-    setPixel(14, 19, primary_color);
-    setPixel(15, 19, secondary_color);
-    setPixel(16, 19, secondary_color);
-    setPixel(17, 19, primary_color);
-    setPixel(20, 19, primary_color);
-    setPixel(21, 19, secondary_color);
-    setPixel(22, 19, primary_color);
-    setPixel(23, 19, primary_color);
-    setPixel(24, 19, secondary_color);
-    setPixel(25, 19, secondary_color);
-    setPixel(26, 19, primary_color);
-    setPixel(0, 20, secondary_color);
-    setPixel(1, 20, secondary_color);
-    setPixel(2, 20, secondary_color);
-    setPixel(3, 20, primary_color);
-    setPixel(6, 20, secondary_color);
-    setPixel(7, 20, secondary_color);
-    setPixel(8, 20, secondary_color);
-    setPixel(9, 20, secondary_color);
-    setPixel(12, 20, secondary_color);
-    setPixel(13, 20, secondary_color);
-    setPixel(14, 20, secondary_color);
-    setPixel(15, 20, secondary_color);
-    setPixel(16, 20, secondary_color);
-    setPixel(20, 20, primary_color);
-    setPixel(21, 20, secondary_color);
-    setPixel(22, 20, secondary_color);
-    setPixel(23, 20, primary_color);
-    setPixel(24, 20, primary_color);
-    setPixel(25, 20, secondary_color);
-    setPixel(26, 20, primary_color);
-    setPixel(27, 20, primary_color);
-    setPixel(0, 21, secondary_color);
-    setPixel(1, 21, secondary_color);
-    setPixel(2, 21, secondary_color);
-    setPixel(3, 21, primary_color);
-    setPixel(6, 21, secondary_color);
-    setPixel(7, 21, secondary_color);
-    setPixel(8, 21, secondary_color);
-    setPixel(11, 21, primary_color);
-    setPixel(12, 21, secondary_color);
-    setPixel(13, 21, secondary_color);
-    setPixel(14, 21, secondary_color);
-    setPixel(15, 21, secondary_color);
-    setPixel(16, 21, primary_color);
-    setPixel(20, 21, primary_color);
-    setPixel(21, 21, secondary_color);
-    setPixel(22, 21, secondary_color);
-    setPixel(23, 21, secondary_color);
-    setPixel(24, 21, primary_color);
-    setPixel(25, 21, primary_color);
-    setPixel(26, 21, secondary_color);
-    setPixel(27, 21, secondary_color);
-    setPixel(28, 21, primary_color);
-    setPixel(0, 22, primary_color);
-    setPixel(1, 22, secondary_color);
-    setPixel(2, 22, secondary_color);
-    setPixel(6, 22, primary_color);
-    setPixel(7, 22, primary_color);
-    setPixel(12, 22, secondary_color);
-    setPixel(13, 22, secondary_color);
-    setPixel(14, 22, primary_color);
-    setPixel(21, 22, secondary_color);
-    setPixel(22, 22, secondary_color);
-    setPixel(23, 22, secondary_color);
-    setPixel(24, 22, secondary_color);
-    setPixel(25, 22, primary_color);
-    setPixel(26, 22, secondary_color);
-    setPixel(27, 22, secondary_color);
-    setPixel(28, 22, secondary_color);
-    setPixel(1, 23, primary_color);
-    setPixel(2, 23, primary_color);
-    setPixel(4, 23, primary_color);
-    setPixel(12, 23, primary_color);
-    setPixel(13, 23, primary_color);
-    setPixel(16, 23, primary_color);
-    setPixel(17, 23, secondary_color);
-    setPixel(18, 23, secondary_color);
-    setPixel(22, 23, primary_color);
-    setPixel(23, 23, primary_color);
-    setPixel(24, 23, primary_color);
-    setPixel(26, 23, primary_color);
-    setPixel(27, 23, primary_color);
-    setPixel(28, 23, primary_color);
-    setPixel(3, 24, secondary_color);
-    setPixel(4, 24, secondary_color);
-    setPixel(8, 24, primary_color);
-    setPixel(9, 24, secondary_color);
-    setPixel(10, 24, primary_color);
-    setPixel(16, 24, secondary_color);
-    setPixel(17, 24, secondary_color);
-    setPixel(18, 24, secondary_color);
-    setPixel(19, 24, primary_color);
-    setPixel(2, 25, secondary_color);
-    setPixel(3, 25, secondary_color);
-    setPixel(4, 25, secondary_color);
-    setPixel(5, 25, primary_color);
-    setPixel(7, 25, primary_color);
-    setPixel(8, 25, secondary_color);
-    setPixel(9, 25, secondary_color);
-    setPixel(10, 25, secondary_color);
-    setPixel(11, 25, primary_color);
-    setPixel(15, 25, primary_color);
-    setPixel(16, 25, primary_color);
-    setPixel(17, 25, secondary_color);
-    setPixel(18, 25, secondary_color);
-    setPixel(19, 25, primary_color);
-    setPixel(22, 25, primary_color);
-    setPixel(23, 25, primary_color);
-    setPixel(24, 25, primary_color);
-    setPixel(27, 25, primary_color);
-    setPixel(28, 25, secondary_color);
-    setPixel(29, 25, secondary_color);
-    setPixel(1, 26, primary_color);
-    setPixel(2, 26, secondary_color);
-    setPixel(3, 26, secondary_color);
-    setPixel(4, 26, secondary_color);
-    setPixel(7, 26, primary_color);
-    setPixel(8, 26, secondary_color);
-    setPixel(9, 26, secondary_color);
-    setPixel(10, 26, secondary_color);
-    setPixel(13, 26, primary_color);
-    setPixel(14, 26, secondary_color);
-    setPixel(15, 26, primary_color);
-    setPixel(16, 26, primary_color);
-    setPixel(17, 26, secondary_color);
-    setPixel(18, 26, secondary_color);
-    setPixel(22, 26, secondary_color);
-    setPixel(23, 26, secondary_color);
-    setPixel(24, 26, secondary_color);
-    setPixel(27, 26, secondary_color);
-    setPixel(28, 26, secondary_color);
-    setPixel(29, 26, secondary_color);
-    setPixel(1, 27, primary_color);
-    setPixel(2, 27, secondary_color);
-    setPixel(3, 27, secondary_color);
-    setPixel(4, 27, primary_color);
-    setPixel(7, 27, primary_color);
-    setPixel(8, 27, primary_color);
-    setPixel(9, 27, secondary_color);
-    setPixel(10, 27, primary_color);
-    setPixel(13, 27, secondary_color);
-    setPixel(14, 27, secondary_color);
-    setPixel(15, 27, primary_color);
-    setPixel(16, 27, secondary_color);
-    setPixel(17, 27, secondary_color);
-    setPixel(18, 27, primary_color);
-    setPixel(21, 27, secondary_color);
-    setPixel(22, 27, secondary_color);
-    setPixel(23, 27, secondary_color);
-    setPixel(24, 27, secondary_color);
-    setPixel(27, 27, secondary_color);
-    setPixel(28, 27, secondary_color);
-    setPixel(29, 27, secondary_color);
-    setPixel(1, 28, primary_color);
-    setPixel(2, 28, secondary_color);
-    setPixel(3, 28, secondary_color);
-    setPixel(4, 28, primary_color);
-    setPixel(6, 28, primary_color);
-    setPixel(7, 28, secondary_color);
-    setPixel(8, 28, secondary_color);
-    setPixel(9, 28, secondary_color);
-    setPixel(10, 28, secondary_color);
-    setPixel(13, 28, primary_color);
-    setPixel(14, 28, secondary_color);
-    setPixel(15, 28, secondary_color);
-    setPixel(16, 28, secondary_color);
-    setPixel(17, 28, secondary_color);
-    setPixel(21, 28, secondary_color);
-    setPixel(22, 28, secondary_color);
-    setPixel(23, 28, secondary_color);
-    setPixel(28, 28, primary_color);
-    setPixel(29, 28, primary_color);
-    setPixel(2, 29, secondary_color);
-    setPixel(3, 29, secondary_color);
-    setPixel(6, 29, secondary_color);
-    setPixel(7, 29, secondary_color);
-    setPixel(8, 29, secondary_color);
-    setPixel(9, 29, secondary_color);
-    setPixel(10, 29, primary_color);
-    setPixel(13, 29, primary_color);
-    setPixel(14, 29, secondary_color);
-    setPixel(15, 29, secondary_color);
-    setPixel(16, 29, secondary_color);
-    setPixel(21, 29, secondary_color);
-    setPixel(22, 29, secondary_color);
-    setPixel(23, 29, secondary_color);
-    setPixel(26, 29, primary_color);
-    setPixel(29, 29, primary_color);
+    setPaletteColor(1, primary_color);
+    setPaletteColor(2, secondary_color);
 }
@@ -0,0 +1,76 @@
+/**
+ * @project OpenHoop
+ * @file TextImage.cpp
+ * @brief Source file for the TextImage class, an image of a line of text drawn with the bitmap font.
+ * @details Implements the layout of the characters and the decoding of pixels and columns from their glyphs.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/images/TextImage.h"
+
+/**
+ * @brief Constructor for TextImage.
+ * @param text Text to draw.
+ * @param color Color of the characters.
+ */
+TextImage::TextImage(const char* text, LedColor color)
+    : LedImage(measure(text) * BitmapFont::ADVANCE, BitmapFont::HEIGHT, {LedColor(), color}), characters() {
+    const int length = measure(text);
+    for (int i = 0; i < length; i++) {
+        characters[i] = text[0] != '\0' ? text[i] : ' ';
+    }
+}
+
+/**
+ * @brief Get the number of characters of the text.
+ */
+int TextImage::getLength() const {
+    return width / BitmapFont::ADVANCE;
+}
+
+/**
+ * @brief Get the number of characters drawn for a text.
+ */
+int TextImage::measure(const char* text) {
+    int length = 0;
+    while (length < TEXT_MAX_LENGTH && text[length] != '\0') {
+        length++;
+    }
+    return length > 0 ? length : 1;
+}
+
+/**
+ * @brief Get the pixels of a column, the top pixel in bit 0.
+ * @details The last column of each character is the blank space before the next one.
+ */
+uint8_t TextImage::columnBits(int x) const {
+    const int glyphX = x % BitmapFont::ADVANCE;
+    return glyphX < BitmapFont::WIDTH ? BitmapFont::glyphColumn(characters[x / BitmapFont::ADVANCE], glyphX) : 0;
+}
+
+/**
+ * @brief Decode the color of a pixel from the glyph of its character.
+ * @param x X-coordinate of the pixel.
+ * @param y Y-coordinate of the pixel.
+ * @return Color of the pixel.
+ */
+LedColor TextImage::decodePixel(int x, int y) const {
+    return paletteColor((columnBits(x) >> y) & 1);
+}
+
+/**
+ * @brief Decode the colors of a column from the glyph of its character.
+ * @param x X-coordinate of the column.
+ * @param pixels Receives the colors of the column.
+ * @param count Number of pixels to decode.
+ */
+void TextImage::decodeColumn(int x, LedColor* pixels, int count) const {
+    const uint8_t bits = columnBits(x);
+    const LedColor background = paletteColor(0);
+    const LedColor foreground = paletteColor(1);
+    for (int y = 0; y < count; y++) {
+        pixels[y] = (bits >> y) & 1 ? foreground : background;
+    }
+}
@@ -13,7 +13,9 @@
 #include "../include/services/BleService.h"
 #include "../include/services/EffectService.h"
 #include "../include/utils/EffectUtils.h"
+#include "../include/utils/ImageProfiler.h"
 #include "../include/Config.h"
+#include "Arduino_BMI270_BMM150.h"
 
 HulaHoopNeoPixel hoop(NUM_LEDS, LEDS_PIN, NEO_GRB + NEO_KHZ800);
 
@@ -24,17 +26,26 @@ void setup() {
     // Initialize the PDM library for sound processing
     PDM.onReceive(EffectUtils::onPDMdata);
 
+    // Initialize the IMU for the motion-driven effects
+    IMU.begin();
+
     // Initialize NeoPixel hoop
     hoop.begin();
     hoop.show();
 
     // Initialize NeoPixel BLE services
     bleService.beginAndAdvertise();
+
+#if IMAGE_PROFILING
+    // Compare the decoding time of the image formats
+    ImageProfiler::report();
+#endif
 }
 
 /**
  * @brief Update BLE communication, check for incoming commands.
- * Handles color code writes, gesture commands, and energy-saving mode changes.
+ * Handles color code writes, gesture commands, energy-saving mode changes, palette uploads, automaton rules, and text
+ * messages.
  */
 void updateBLE() {
     BLEDevice central = BLE.central();
@@ -61,6 +72,32 @@ void updateBLE() {
         uint8_t energySavingMode = bleService.energySavingModeCharacteristic.value();
         hoop.setEnergySavingMode(energySavingMode);
     }
+
+    // Check for palette uploads
+    if (bleService.paletteCharacteristic.written()) {
+        effectService->dispatchPaletteCommand(bleService.paletteCharacteristic.value(),
+                                              bleService.paletteCharacteristic.valueLength());
+    }
+
+    // Check for cellular automaton rule writes
+    if (bleService.automatonRuleCharacteristic.written()) {
+        uint32_t ruleCode = bleService.automatonRuleCharacteristic.value();
+        effectService->dispatchAutomatonCommand(ruleCode);
+        Serial.print("Automaton Rule Received: ");
+        Serial.println(ruleCode, HEX);
+        bleService.effectCharacteristic.writeValue(static_cast<uint8_t>(EffectType::AUTOMATON));
+        bleService.solidColorCharacteristic.writeValue("NO COLOR");
+    }
+
+    // Check for text message writes
+    if (bleService.textCharacteristic.written()) {
+        String text = bleService.textCharacteristic.value();
+        effectService->dispatchTextCommand(text);
+        Serial.print("Text Received: ");
+        Serial.println(text);
+        bleService.effectCharacteristic.writeValue(static_cast<uint8_t>(EffectType::TEXT));
+        bleService.solidColorCharacteristic.writeValue("NO COLOR");
+    }
 }
 
 /**
@@ -16,7 +16,8 @@
  * @class BleService
  * @brief Handles BLE communication for the HulaHoop device.
  * @details This class initializes and configures BLE services and characteristics for the HulaHoop, including battery level,
- * effects control, solid color settings, energy-saving mode, and device information.
+ * effects control, solid color settings, energy-saving mode, palette upload, automaton rules, text messages, and device
+ * information.
  */
 
 /**
@@ -29,6 +30,9 @@ BleService::BleService():
         effectCharacteristic(EFFECT_SERVICE_UUID, BLERead | BLEWrite),
         solidColorCharacteristic(SCOLOR_SERVICE_UUID, BLERead | BLEWrite, 8),
         energySavingModeCharacteristic(ENERGY_SERVICE_UUID, BLERead | BLEWrite),
+        paletteCharacteristic(PALETTE_SERVICE_UUID, BLERead | BLEWrite, PALETTE_MAX_STOPS * 4),
+        automatonRuleCharacteristic(AUTOMATON_SERVICE_UUID, BLERead | BLEWrite),
+        textCharacteristic(TEXT_SERVICE_UUID, BLERead | BLEWrite, TEXT_MAX_LENGTH),
         hulaHoopService("1812"),
         reportDescriptor("2908", "04 0B 00 0B 00 03 00 00 00 00 00 00 00 00 00 00 00 00 00 00"),
         reportMapCharacteristic("2A4B", BLERead | BLENotify),
@@ -72,6 +76,11 @@ void BleService::beginAndAdvertise() {
     solidColorCharacteristic.writeValue("NO COLOR");
     hulaHoopControlService.addCharacteristic(energySavingModeCharacteristic);
     energySavingModeCharacteristic.writeValue(0);
+    hulaHoopControlService.addCharacteristic(paletteCharacteristic);
+    hulaHoopControlService.addCharacteristic(automatonRuleCharacteristic);
+    automatonRuleCharacteristic.writeValue(30);
+    hulaHoopControlService.addCharacteristic(textCharacteristic);
+    textCharacteristic.writeValue("OpenHoop");
     deviceInformationService.addCharacteristic(pnpIdCharacteristic);
     deviceInformationService.addCharacteristic(manufacturerCharacteristic);
     deviceInformationService.addCharacteristic(modelCharacteristic);
@@ -19,12 +19,64 @@
 #include "../../include/effects/SpectrumEffect.h"
 #include "../../include/effects/RainbowLeopardEffect.h"
 #include "../../include/effects/MushroomImageEffect.h"
+#include "../../include/effects/AutomatonEffect.h"
+#include "../../include/effects/SparksEffect.h"
+#include "../../include/effects/FluidEffect.h"
+#include "../../include/effects/ImageScrollerEffect.h"
+#include "../../include/effects/PovEffect.h"
+#include "../../include/images/MushroomImage.h"
+#include "../../include/images/TextImage.h"
+#include "../../include/utils/EffectUtils.h"
+#include "../../include/Config.h"
 #include <Adafruit_NeoPixel.h>
 
+/**
+ * @brief Constructor for EffectService.
+ * Effects whose pattern repeats around the hoop only render half of it and are mirrored onto the other half, and
+ * smooth gradients render at a quarter of the resolution and are interpolated back to the full strip. Image scrollers
+ * step at their original pace and the automaton steps a readable 15 generations per second, both interpolated in
+ * between.
+ */
+EffectService::EffectService() {
+    EffectOptions mirrored;
+    mirrored.symmetry = SymmetryMode::MIRROR;
+    mirrored.folds = 2;
+
+    effectOptions[EffectType::RAINBOW] = mirrored;
+    effectOptions[EffectType::COLORWAVE] = mirrored;
+    effectOptions[EffectType::FUNKY] = mirrored;
+
+    EffectOptions stabilizedMirror = mirrored;
+    stabilizedMirror.stabilized = true;
+    effectOptions[EffectType::RASTAFARAIFLAG] = stabilizedMirror;
+
+    EffectOptions lowResolution;
+    lowResolution.resolution = NUM_LEDS / 4;
+    lowResolution.upsample = UpsampleMode::LINEAR;
+
+    effectOptions[EffectType::PULSE] = lowResolution;
+
+    EffectOptions leopardRate;
+    leopardRate.simulationRate = 16;
+    effectOptions[EffectType::LEOPARDRAINBOW] = leopardRate;
+
+    EffectOptions mushroomRate;
+    mushroomRate.simulationRate = 33;
+    effectOptions[EffectType::MUSHROOM] = mushroomRate;
+
+    EffectOptions automatonRate;
+    automatonRate.simulationRate = 15;
+    effectOptions[EffectType::AUTOMATON] = automatonRate;
+
+    EffectOptions textRate;
+    textRate.simulationRate = 20;
+    effectOptions[EffectType::TEXT] = textRate;
+}
+
 /**
  * @brief Set a new effect, stopping and deleting the current one if it exists.
  */
-void EffectService::setEffect(std::unique_ptr<Effect> newEffect) {
+void EffectService::setEffect(std::unique_ptr<Effect> newEffect, const EffectOptions& options) {
     // The unique_ptr will automatically handle the deletion of the currentEffect
     // when it goes out of scope or gets replaced.
     if (currentEffect) {
@@ -33,20 +85,122 @@ void EffectService::setEffect(std::unique_ptr<Effect> newEffect) {
 
     currentEffect = std::move(newEffect);
 
-    // Start the new effect
+    // Apply the rendering options before the new effect queries the hoop size
+    hoop.setSymmetry(options.symmetry, options.folds);
+    hoop.setResolution(options.resolution, options.upsample);
+
+    // Stabilized effects start with their first pixel at the bottom of the hoop, then follow the gyroscope
+    stabilized = options.stabilized;
+    const uint16_t bottom = stabilized ? EffectUtils::getDownAngle() : 0;
+    rotation.reset(static_cast<uint32_t>(static_cast<uint16_t>(-bottom)) << 16);
+    hoop.setRotation(static_cast<uint16_t>(-bottom));
+
+    // Effects with a simulation rate update on their own clock, starting right away
+    simulationPeriod = options.simulationRate > 0 ? 1000000UL / options.simulationRate : 0;
+    lastSimulation = micros() - simulationPeriod;
+    hoop.setFrameInterpolation(simulationPeriod > 0);
+
+    // Start the new effect, replacing its palette once it has loaded its own
     if (currentEffect) {
         currentEffect->start();
+        if (hasCustomPalette) {
+            currentEffect->setPalette(customPalette);
+        }
     }
 }
 
 /**
  * @brief Update the current effect if it exists.
+ * @details Effects with a simulation rate are only updated once per simulation period. In between, the hoop shows
+ * frames interpolated between the last two frames the effect rendered.
  */
-void EffectService::update() const {
+void EffectService::update() {
+    if (!currentEffect) {
+        return;
+    }
+
+    if (stabilized) {
+        updateRotation();
+    }
+
+    if (simulationPeriod > 0) {
+        uint32_t elapsed = micros() - lastSimulation;
+        if (elapsed < simulationPeriod) {
+            hoop.setFrameBlend(elapsed * 256 / simulationPeriod);
+            hoop.show();
+            return;
+        }
+
+        // Skip the missed steps rather than catching up if the effect falls behind
+        lastSimulation = elapsed < 2 * simulationPeriod ? lastSimulation + simulationPeriod : micros();
+        hoop.commitFrame();
+    }
+
     // Update the current effect
-    if (currentEffect) {
-        currentEffect->update();
+#if EFFECT_PROFILING
+    uint32_t updateStart = micros();
+    currentEffect->update();
+    profileFrame(updateStart);
+#else
+    currentEffect->update();
+#endif
+}
+
+/**
+ * @brief Read the gyroscope and turn the composed frame back by the angle the hoop turned.
+ * @details The gyroscope is read far less often than frames are shown, so the angle is extrapolated to the current
+ * time. Only integrating the rate, the angle slowly drifts away from the bottom it started at.
+ */
+void EffectService::updateRotation() {
+    int32_t rate;
+    const uint32_t now = micros();
+    if (EffectUtils::getRotationRate(rate)) {
+        rotation.addReading(rate, now);
     }
+    hoop.setRotation(static_cast<uint16_t>(rotation.getAngle(now) >> 16));
+}
+
+/**
+ * @brief Accumulate the render time of a frame and print the average every EFFECT_PROFILING_FRAMES frames.
+ * @details The render time runs from the start of the effect update until the effect calls show(), so it excludes
+ * the time spent composing and sending the frame to the strip.
+ * @param updateStart Time in microseconds at which the effect update started.
+ */
+void EffectService::profileFrame(uint32_t updateStart) {
+    // Effects that did not show a frame during this update have nothing to measure
+    auto renderTime = static_cast<int32_t>(hoop.getLastShowMicros() - updateStart);
+    if (renderTime < 0) {
+        return;
+    }
+
+    renderMicros += renderTime;
+    renderedFrames++;
+
+    if (renderedFrames >= EFFECT_PROFILING_FRAMES) {
+        Serial.print("Average Render Time (us): ");
+        Serial.println(renderMicros / renderedFrames);
+        renderMicros = 0;
+        renderedFrames = 0;
+    }
+}
+
+/**
+ * @brief Set the rendering options used the next time an effect is dispatched.
+ * @param type Effect the options apply to.
+ * @param options Rendering options of the effect.
+ */
+void EffectService::setEffectOptions(EffectType type, const EffectOptions& options) {
+    effectOptions[type] = options;
+}
+
+/**
+ * @brief Get the rendering options of an effect.
+ * @param type Effect to look up.
+ * @return Rendering options of the effect, or the defaults if none were set.
+ */
+EffectOptions EffectService::getEffectOptions(EffectType type) const {
+    auto options = effectOptions.find(type);
+    return options != effectOptions.end() ? options->second : EffectOptions();
 }
 
 /**
@@ -54,42 +208,63 @@ void EffectService::update() const {
  * @param gesture The type of effect to dispatch.
  */
 void EffectService::dispatchEffectCommand(EffectType gesture) {
+    std::unique_ptr<Effect> effect;
+
     switch (gesture) {
         case EffectType::NO_EFFECT:
-            setEffect(std::make_unique<SolidColorFillEffect>(Adafruit_NeoPixel::Color(0, 0, 0)));
+            effect = std::make_unique<SolidColorFillEffect>(RgbColor(0, 0, 0));
             break;
         case EffectType::RAINBOW:
-            setEffect(std::make_unique<RainbowEffect>());
+            effect = std::make_unique<RainbowEffect>();
             break;
         case EffectType::FIRE:
-            setEffect(std::make_unique<FireEffect>());
+            effect = std::make_unique<FireEffect>(micros());
             break;
         case EffectType::PULSE:
-            setEffect(std::make_unique<PulseEffect>());
+            effect = std::make_unique<PulseEffect>();
             break;
         case EffectType::COLORWAVE:
-            setEffect(std::make_unique<ColorWaveEffect>());
+            effect = std::make_unique<ColorWaveEffect>();
             break;
         case EffectType::FUNKY:
-            setEffect(std::make_unique<FunkyEffect>());
+            effect = std::make_unique<FunkyEffect>();
             break;
         case EffectType::RASTAFARAIFLAG:
-            setEffect(std::make_unique<RastafaraiFlagEffect>());
+            effect = std::make_unique<RastafaraiFlagEffect>();
             break;
         case EffectType::SPECTRUM:
-            setEffect(std::make_unique<SpectrumEffect>());
+            effect = std::make_unique<SpectrumEffect>();
             break;
         case EffectType::MUSHROOM:
-            setEffect(std::make_unique<MushroomImageEffect>());
+            effect = std::make_unique<MushroomImageEffect>();
             break;
         case EffectType::LEOPARDRAINBOW:
-            setEffect(std::make_unique<RainbowLeopardEffect>());
+            effect = std::make_unique<RainbowLeopardEffect>();
+            break;
+        case EffectType::AUTOMATON:
+            effect = std::make_unique<AutomatonEffect>(automatonRule, micros());
+            break;
+        case EffectType::SPARKS:
+            effect = std::make_unique<SparksEffect>(micros());
+            break;
+        case EffectType::FLUID:
+            effect = std::make_unique<FluidEffect>();
+            break;
+        case EffectType::POV:
+            effect = std::make_unique<PovEffect<MushroomImage>>(MushroomImage({255, 0, 0}));
+            break;
+        case EffectType::TEXT:
+            effect = std::make_unique<ImageScrollerEffect<TextImage>>(TextImage(message.c_str(), {255, 255, 255}));
+            break;
+        case EffectType::POV_TEXT:
+            effect = std::make_unique<PovEffect<TextImage>>(TextImage(message.c_str(), {255, 255, 255}));
             break;
         default:
             // Stop the current effect if no matching gesture is found
-            setEffect(nullptr);
             break;
     }
+
+    setEffect(std::move(effect), getEffectOptions(gesture));
 }
 
 /**
@@ -100,7 +275,7 @@ void EffectService::dispatchSolidColorCommand(const String& colorString) {
     // Handle potential errors gracefully:
     if (colorString.length() != 6) {
         Serial.println("Invalid color code length (must be 6 characters)");
-        setEffect(std::make_unique<SolidColorFillEffect>(Adafruit_NeoPixel::Color(0, 0, 0))); // Set default color in case of error
+        setEffect(std::make_unique<SolidColorFillEffect>(RgbColor(0, 0, 0))); // Set default color in case of error
         return;
     }
 
@@ -116,7 +291,73 @@ void EffectService::dispatchSolidColorCommand(const String& colorString) {
     Serial.print("Blue: "); Serial.println(blue);
 
     // Create and set the solid color effect:
-    setEffect(std::make_unique<SolidColorFillEffect>(Adafruit_NeoPixel::Color(red, green, blue)));
+    setEffect(std::make_unique<SolidColorFillEffect>(RgbColor(red, green, blue)));
+}
+
+/**
+ * @brief Dispatch a palette command based on the provided gradient stops.
+ * @details The palette applies to the current effect and to every effect dispatched afterwards, until an empty command
+ * lets the effects dispatched afterwards use their own palettes again.
+ * @param data The gradient stops, four bytes each: position, red, green and blue.
+ * @param length The number of bytes received.
+ */
+void EffectService::dispatchPaletteCommand(const uint8_t* data, int length) {
+    if (length == 0) {
+        Serial.println("Palette Cleared");
+        hasCustomPalette = false;
+        return;
+    }
+
+    // Handle potential errors gracefully:
+    int stopCount = length / 4;
+    if (length % 4 != 0 || stopCount < 2 || stopCount > PALETTE_MAX_STOPS) {
+        Serial.println("Invalid palette length (must be 2 to PALETTE_MAX_STOPS stops of 4 bytes)");
+        return;
+    }
+
+    GradientStop stops[PALETTE_MAX_STOPS];
+    for (int i = 0; i < stopCount; i++) {
+        const uint8_t* stop = data + i * 4;
+        if (i > 0 && stop[0] < stops[i - 1].position) {
+            Serial.println("Invalid palette (stop positions must not decrease)");
+            return;
+        }
+        stops[i] = {stop[0], RgbColor(stop[1], stop[2], stop[3])};
+    }
+
+    Serial.print("Palette Received: ");
+    Serial.print(stopCount);
+    Serial.println(" stops");
+
+    customPalette.load(stops, stopCount);
+    hasCustomPalette = true;
+    if (currentEffect) {
+        currentEffect->setPalette(customPalette);
+    }
+}
+
+/**
+ * @brief Dispatch a cellular automaton command, restarting the automaton effect with the provided rule.
+ * @details Invalid codes are rejected and the automaton restarts with the previous rule.
+ * @param ruleCode The rule code, as decoded by AutomatonRule::fromCode.
+ */
+void EffectService::dispatchAutomatonCommand(uint32_t ruleCode) {
+    if (AutomatonRule::isValidCode(ruleCode)) {
+        automatonRule = ruleCode;
+    } else {
+        Serial.println("Invalid automaton rule code, keeping the previous rule");
+    }
+    dispatchEffectCommand(EffectType::AUTOMATON);
+}
+
+/**
+ * @brief Dispatch a text message command, scrolling the text along the hoop.
+ * @details The text is kept for the text effects, so switching to POV_TEXT afterwards paints the same message.
+ * @param text The text to show, cut at TEXT_MAX_LENGTH characters when drawn.
+ */
+void EffectService::dispatchTextCommand(const String& text) {
+    message = text;
+    dispatchEffectCommand(EffectType::TEXT);
 }
 
 EffectService::~EffectService() = default;
@@ -0,0 +1,255 @@
+/**
+ * @project OpenHoop
+ * @file CellularAutomaton.cpp
+ * @brief Source file for the CellularAutomaton class, a one-dimensional cellular automaton around the hoop.
+ * @details Implements the automaton steps as bit-sliced logic: every operation works on 32 cells at once, neighbour
+ * counts are summed by word-wide adders, and rules are matched by OR-ing the minterms of the neighbourhoods they
+ * select.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/CellularAutomaton.h"
+#include <string.h>
+
+constexpr uint16_t CellularAutomaton::MAX_CELLS;
+constexpr uint8_t CellularAutomaton::MAX_STATES;
+
+/**
+ * @brief Decode a rule from its 32-bit code.
+ */
+AutomatonRule AutomatonRule::fromCode(uint32_t code) {
+    AutomatonRule rule;
+    rule.wolfram = code & 0xFF;
+    rule.birth = (code >> 8) & 0x1F;
+    rule.survive = (code >> 16) & 0x1F;
+    rule.states = code >> 24;
+    if (rule.states == 1) {
+        rule.states = 2;
+    } else if (rule.states > CellularAutomaton::MAX_STATES) {
+        rule.states = CellularAutomaton::MAX_STATES;
+    }
+    return rule;
+}
+
+/**
+ * @brief Check whether a code describes a rule.
+ */
+bool AutomatonRule::isValidCode(uint32_t code) {
+    if (code < 256) {
+        return code != 0;
+    }
+    const uint8_t states = code >> 24;
+    const uint8_t birth = (code >> 8) & 0x1F;
+    return states >= 1 && states <= CellularAutomaton::MAX_STATES && birth != 0;
+}
+
+/**
+ * @brief Clear the automaton and set its size and rule.
+ */
+void CellularAutomaton::reset(uint16_t cellCount, const AutomatonRule& newRule) {
+    size = cellCount < MAX_CELLS ? cellCount : MAX_CELLS;
+    words = (size + 31) / 32;
+    lastMask = size % 32 ? (1UL << (size % 32)) - 1 : 0xFFFFFFFF;
+    generation = 0;
+    rule = newRule;
+    memset(alive, 0, sizeof(alive));
+    memset(age, 0, sizeof(age));
+}
+
+/**
+ * @brief Bring the cell at the middle of the ring to life.
+ */
+void CellularAutomaton::seedCenter() {
+    if (size > 0) {
+        alive[(size / 2) / 32] |= 1UL << ((size / 2) % 32);
+    }
+}
+
+/**
+ * @brief Bring random cells to life.
+ */
+void CellularAutomaton::seedRandom(FastRandom& random, uint8_t density) {
+    for (uint16_t cell = 0; cell < size; cell++) {
+        if (random.random8() < density) {
+            alive[cell / 32] |= 1UL << (cell % 32);
+        }
+    }
+}
+
+/**
+ * @brief Advance the automaton by a generation.
+ */
+void CellularAutomaton::step() {
+    if (size == 0) {
+        return;
+    }
+
+    if (rule.states == 0) {
+        stepElementary();
+    } else {
+        stepGenerations();
+    }
+    generation++;
+}
+
+/**
+ * @brief Get the state of a cell.
+ */
+uint8_t CellularAutomaton::getState(uint16_t cell) const {
+    const uint8_t word = cell / 32;
+    const uint8_t bit = cell % 32;
+    if ((alive[word] >> bit) & 1) {
+        return 1;
+    }
+
+    uint8_t cellAge = 0;
+    for (uint8_t plane = 0; plane < AGE_PLANES; plane++) {
+        cellAge |= ((age[plane][word] >> bit) & 1) << plane;
+    }
+    return cellAge ? cellAge + 1 : 0;
+}
+
+/**
+ * @brief Check whether every cell is dead.
+ */
+bool CellularAutomaton::isEmpty() const {
+    uint32_t any = 0;
+    for (uint8_t w = 0; w < words; w++) {
+        any |= alive[w] | age[0][w] | age[1][w] | age[2][w];
+    }
+    return any == 0;
+}
+
+/**
+ * @brief Get the number of generations stepped since the last reset.
+ */
+uint32_t CellularAutomaton::getGeneration() const {
+    return generation;
+}
+
+/**
+ * @brief Get the rule the automaton steps with.
+ */
+const AutomatonRule& CellularAutomaton::getRule() const {
+    return rule;
+}
+
+/**
+ * @brief Rotate the ring by one cell.
+ * @details Words shift by one bit and pass their edge bit to the neighbouring word, then the bit that falls off one
+ * end of the ring is moved to the other end. Bits past the last cell are kept clear.
+ */
+void CellularAutomaton::rotate(const uint32_t* source, uint32_t* destination, bool fromNext) const {
+    const uint8_t last = words - 1;
+    const uint8_t lastBit = (size - 1) % 32;
+
+    if (fromNext) {
+        for (uint8_t w = 0; w < last; w++) {
+            destination[w] = (source[w] >> 1) | (source[w + 1] << 31);
+        }
+        destination[last] = (source[last] >> 1) | ((source[0] & 1) << lastBit);
+    } else {
+        const uint32_t wrapped = (source[last] >> lastBit) & 1;
+        for (uint8_t w = last; w > 0; w--) {
+            destination[w] = (source[w] << 1) | (source[w - 1] >> 31);
+        }
+        destination[0] = (source[0] << 1) | wrapped;
+        destination[last] &= lastMask;
+    }
+}
+
+/**
+ * @brief Step an elementary rule over the three-cell neighbourhoods.
+ * @details Bit p of the Wolfram rule gives the next state of a cell whose previous neighbour, itself and next neighbour
+ * spell p in binary, so the next generation is the OR of the minterms of the set bits.
+ */
+void CellularAutomaton::stepElementary() {
+    uint32_t previous[MAX_WORDS];
+    uint32_t next[MAX_WORDS];
+    rotate(alive, previous, false);
+    rotate(alive, next, true);
+
+    for (uint8_t w = 0; w < words; w++) {
+        const uint32_t l = previous[w];
+        const uint32_t c = alive[w];
+        const uint32_t r = next[w];
+        uint32_t result = 0;
+        for (uint8_t pattern = 0; pattern < 8; pattern++) {
+            if ((rule.wolfram >> pattern) & 1) {
+                result |= ((pattern & 4) ? l : ~l) & ((pattern & 2) ? c : ~c) & ((pattern & 1) ? r : ~r);
+            }
+        }
+        alive[w] = result;
+    }
+    alive[words - 1] &= lastMask;
+}
+
+/**
+ * @brief Step a life-like or generations rule over the four nearest neighbours.
+ * @details The live neighbours at distances 1 and 2 on both sides are summed into a 3-bit count by word-wide adders,
+ * and the birth and survive masks are matched against the count. Under a generations rule, live cells that do not
+ * survive start decaying instead of dying, and decaying cells age by one per step until they reach the last state.
+ */
+void CellularAutomaton::stepGenerations() {
+    uint32_t previous1[MAX_WORDS], previous2[MAX_WORDS], next1[MAX_WORDS], next2[MAX_WORDS];
+    rotate(alive, previous1, false);
+    rotate(previous1, previous2, false);
+    rotate(alive, next1, true);
+    rotate(next1, next2, true);
+
+    for (uint8_t w = 0; w < words; w++) {
+        // Sum the four neighbours as two 2-bit halves, then add the halves
+        const uint32_t lowSum = previous1[w] ^ previous2[w];
+        const uint32_t lowCarry = previous1[w] & previous2[w];
+        const uint32_t highSum = next1[w] ^ next2[w];
+        const uint32_t highCarry = next1[w] & next2[w];
+        const uint32_t bit0 = lowSum ^ highSum;
+        const uint32_t carry0 = lowSum & highSum;
+        const uint32_t bit1 = lowCarry ^ highCarry ^ carry0;
+        const uint32_t bit2 = (lowCarry & highCarry) | (carry0 & (lowCarry ^ highCarry));
+
+        // Match the count against the masks, one minterm per count from 0 to 4
+        uint32_t born = 0;
+        uint32_t survives = 0;
+        for (uint8_t count = 0; count <= 4; count++) {
+            const uint32_t equal = ((count & 1) ? bit0 : ~bit0) & ((count & 2) ? bit1 : ~bit1) &
+                                   ((count & 4) ? bit2 : ~bit2);
+            if ((rule.birth >> count) & 1) {
+                born |= equal;
+            }
+            if ((rule.survive >> count) & 1) {
+                survives |= equal;
+            }
+        }
+
+        const uint32_t cells = alive[w];
+        const uint32_t decaying = age[0][w] | age[1][w] | age[2][w];
+        alive[w] = (born & ~cells & ~decaying) | (survives & cells);
+
+        if (rule.states > 2) {
+            // Age the decaying cells with a ripple-carry increment
+            uint32_t carry = decaying;
+            for (uint8_t plane = 0; plane < AGE_PLANES; plane++) {
+                const uint32_t bit = age[plane][w];
+                age[plane][w] = bit ^ carry;
+                carry &= bit;
+            }
+
+            // Cells past the last state die; ages past 7 already wrapped around to 0
+            const uint8_t expired = rule.states - 1;
+            uint32_t done = ~static_cast<uint32_t>(0);
+            for (uint8_t plane = 0; plane < AGE_PLANES; plane++) {
+                done &= ((expired >> plane) & 1) ? age[plane][w] : ~age[plane][w];
+            }
+            for (uint8_t plane = 0; plane < AGE_PLANES; plane++) {
+                age[plane][w] &= ~done;
+            }
+
+            // Live cells that do not survive start decaying
+            age[0][w] |= cells & ~survives;
+        }
+    }
+    alive[words - 1] &= lastMask;
+}
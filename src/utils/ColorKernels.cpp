@@ -0,0 +1,161 @@
+/**
+ * @project OpenHoop
+ * @file ColorKernels.cpp
+ * @brief Source file for the ColorKernels class, containing whole-frame color operations.
+ * @details Implements the frame kernels on top of four word-level operations. Frames are processed as a flat run of
+ * channels, four per word; the last few channels are loaded into a partial word so every channel goes through the same
+ * code.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/ColorKernels.h"
+#include <string.h>
+
+// The Cortex-M4 DSP extension has saturating SIMD instructions working on four bytes at once
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define COLOR_KERNELS_DSP 1
+#else
+#define COLOR_KERNELS_DSP 0
+#endif
+
+namespace {
+
+constexpr uint32_t EVEN_CHANNELS = 0x00FF00FF;  ///< Mask of channels 0 and 2 of a word.
+constexpr uint32_t HIGH_BITS = 0x80808080;  ///< Mask of the top bit of each channel of a word.
+
+/**
+ * @brief Apply a word operation to every channel of two frames.
+ * @param destination Channels to update.
+ * @param source Channels to combine with, or the destination itself for single-frame operations.
+ * @param count Number of colors.
+ * @param operation Word operation taking a destination and a source word and returning the new destination word.
+ */
+template<typename Operation>
+void forEachWord(RgbColor* destination, const RgbColor* source, uint16_t count, Operation operation) {
+    auto* output = reinterpret_cast<uint8_t*>(destination);
+    const auto* input = reinterpret_cast<const uint8_t*>(source);
+    const uint32_t channels = count * 3;
+
+    uint32_t i = 0;
+    for (; i + 4 <= channels; i += 4) {
+        uint32_t a, b;
+        memcpy(&a, output + i, 4);
+        memcpy(&b, input + i, 4);
+        a = operation(a, b);
+        memcpy(output + i, &a, 4);
+    }
+
+    if (i < channels) {
+        uint32_t a = 0, b = 0;
+        memcpy(&a, output + i, channels - i);
+        memcpy(&b, input + i, channels - i);
+        a = operation(a, b);
+        memcpy(output + i, &a, channels - i);
+    }
+}
+
+}
+
+/**
+ * @brief Scale the four channels of a word by weight/256.
+ * @details Even and odd channels are spread into 16-bit lanes so each product fits its lane without carrying into the
+ * next one.
+ * @param word Four channels.
+ * @param weight Scale from 0 to 256.
+ * @return Scaled channels.
+ */
+uint32_t ColorKernels::scaleWord(uint32_t word, uint32_t weight) {
+    uint32_t even = ((word & EVEN_CHANNELS) * weight) >> 8;
+    uint32_t odd = ((word >> 8) & EVEN_CHANNELS) * weight;
+    return (even & EVEN_CHANNELS) | (odd & ~EVEN_CHANNELS);
+}
+
+/**
+ * @brief Add the four channels of two words, saturating at 255.
+ * @details The portable path adds the low seven bits of each channel, restores the top bit with an exclusive or, and
+ * turns the carry out of each channel into a 0xFF mask.
+ * @param a First four channels.
+ * @param b Second four channels.
+ * @return Saturated sums.
+ */
+uint32_t ColorKernels::addWord(uint32_t a, uint32_t b) {
+#if COLOR_KERNELS_DSP
+    uint32_t result;
+    __asm__("uqadd8 %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    uint32_t sum = ((a & ~HIGH_BITS) + (b & ~HIGH_BITS)) ^ ((a ^ b) & HIGH_BITS);
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & HIGH_BITS;
+    return sum | ((carry >> 7) * 0xFF);
+#endif
+}
+
+/**
+ * @brief Subtract the four channels of two words, saturating at 0.
+ * @details The portable path uses max(a - b, 0) = 255 - min(255 - a + b, 255).
+ * @param a Four channels to subtract from.
+ * @param b Four channels to subtract.
+ * @return Saturated differences.
+ */
+uint32_t ColorKernels::subtractWord(uint32_t a, uint32_t b) {
+#if COLOR_KERNELS_DSP
+    uint32_t result;
+    __asm__("uqsub8 %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return ~addWord(~a, b);
+#endif
+}
+
+/**
+ * @brief Blend the four channels of two words, weighting the second one by weight/256.
+ * @param a Four channels weighted by (256 - weight)/256.
+ * @param b Four channels weighted by weight/256.
+ * @param weight Weight from 0 to 256.
+ * @return Blended channels.
+ */
+uint32_t ColorKernels::blendWord(uint32_t a, uint32_t b, uint32_t weight) {
+    const uint32_t inverse = 256 - weight;
+    uint32_t even = ((a & EVEN_CHANNELS) * inverse + (b & EVEN_CHANNELS) * weight) >> 8;
+    uint32_t odd = ((a >> 8) & EVEN_CHANNELS) * inverse + ((b >> 8) & EVEN_CHANNELS) * weight;
+    return (even & EVEN_CHANNELS) | (odd & ~EVEN_CHANNELS);
+}
+
+/**
+ * @brief Fade colors towards black.
+ */
+void ColorKernels::fadeToBlack(RgbColor* pixels, uint16_t count, uint8_t amount) {
+    scale(pixels, count, 255 - amount);
+}
+
+/**
+ * @brief Scale colors by a global brightness, matching RgbColor::scale8.
+ */
+void ColorKernels::scale(RgbColor* pixels, uint16_t count, uint8_t scale) {
+    const uint32_t weight = scale + 1;
+    forEachWord(pixels, pixels, count, [weight](uint32_t a, uint32_t) { return scaleWord(a, weight); });
+}
+
+/**
+ * @brief Add colors, saturating each channel at 255.
+ */
+void ColorKernels::add(RgbColor* destination, const RgbColor* source, uint16_t count) {
+    forEachWord(destination, source, count, [](uint32_t a, uint32_t b) { return addWord(a, b); });
+}
+
+/**
+ * @brief Subtract colors, saturating each channel at 0.
+ */
+void ColorKernels::subtract(RgbColor* destination, const RgbColor* source, uint16_t count) {
+    forEachWord(destination, source, count, [](uint32_t a, uint32_t b) { return subtractWord(a, b); });
+}
+
+/**
+ * @brief Blend colors over others, an alpha of 255 copying the source exactly.
+ */
+void ColorKernels::blend(RgbColor* destination, const RgbColor* source, uint16_t count, uint8_t alpha) {
+    const uint32_t weight = alpha + (alpha >> 7);
+    forEachWord(destination, source, count, [weight](uint32_t a, uint32_t b) { return blendWord(a, b, weight); });
+}
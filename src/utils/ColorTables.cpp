@@ -0,0 +1,94 @@
+/**
+ * @project OpenHoop
+ * @file ColorTables.cpp
+ * @brief Source file for the ColorTables class, containing precomputed color lookup tables.
+ * @details Generates the hue and color wheel tables with constexpr functions, so the compiler stores them as constant
+ * data in flash and no color math runs on the board, and implements the gradient fills on top of them.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/ColorTables.h"
+
+namespace {
+
+/**
+ * @brief Compute a fully saturated hue, splitting the color circle into six sectors of 256/6 positions.
+ * @details Within each sector one channel stays at 255, one stays at 0 and the third ramps up or down, so neighbouring
+ * hues differ by a few steps of a single channel.
+ */
+constexpr RgbColor hueColor(uint8_t hue) {
+    const uint16_t scaled = hue * 6;
+    const auto rise = static_cast<uint8_t>(scaled & 0xFF);
+    const auto fall = static_cast<uint8_t>(255 - rise);
+    switch (scaled >> 8) {
+        case 0: return {255, rise, 0};
+        case 1: return {fall, 255, 0};
+        case 2: return {0, 255, rise};
+        case 3: return {0, fall, 255};
+        case 4: return {rise, 0, 255};
+        default: return {255, 0, fall};
+    }
+}
+
+/**
+ * @brief Compute a color wheel position, as the former per-call Wheel implementation did.
+ */
+constexpr RgbColor wheelColor(uint8_t position) {
+    position = 255 - position;
+    if (position < 85) {
+        return {static_cast<uint8_t>(255 - position * 3), 0, static_cast<uint8_t>(position * 3)};
+    } else if (position < 170) {
+        position -= 85;
+        return {0, static_cast<uint8_t>(255 - position * 3), static_cast<uint8_t>(position * 3)};
+    } else {
+        position -= 170;
+        return {static_cast<uint8_t>(position * 3), 0, static_cast<uint8_t>(255 - position * 3)};
+    }
+}
+
+/**
+ * @brief Generate a table by evaluating a color function at every position.
+ */
+template<typename Generator>
+constexpr ColorTable makeTable(Generator generator) {
+    ColorTable table{};
+    for (int i = 0; i < 256; i++) {
+        table.colors[i] = generator(static_cast<uint8_t>(i));
+    }
+    return table;
+}
+
+}
+
+constexpr ColorTable ColorTables::HUE = makeTable(hueColor);
+constexpr ColorTable ColorTables::WHEEL = makeTable(wheelColor);
+
+/**
+ * @brief Fill colors with a hue gradient.
+ */
+void ColorTables::fillHueGradient(RgbColor* pixels, uint16_t count, uint16_t startHue, uint16_t delta) {
+    fillGradient(HUE, pixels, count, startHue, delta);
+}
+
+/**
+ * @brief Fill colors with a color wheel gradient.
+ */
+void ColorTables::fillWheelGradient(RgbColor* pixels, uint16_t count, uint16_t startPosition, uint16_t delta) {
+    fillGradient(WHEEL, pixels, count, startPosition, delta);
+}
+
+/**
+ * @brief Fill colors with a gradient read from a table.
+ * @details The position accumulates in 8.8 fixed point and wraps around the table, so each color costs an addition
+ * and a table read.
+ */
+void ColorTables::fillGradient(const ColorTable& table, RgbColor* pixels, uint16_t count, uint16_t start,
+                               uint16_t delta) {
+    uint16_t position = start;
+    for (uint16_t i = 0; i < count; i++) {
+        pixels[i] = table.colors[position >> 8];
+        position += delta;
+    }
+}
@@ -10,41 +10,33 @@
  */
 
 #include "../../include/utils/EffectUtils.h"
+#include "../../include/utils/ColorTables.h"
+#include "../../include/utils/FixedMath.h"
 #include "../../include/Config.h"
 #include "Arduino_BMI270_BMM150.h"
 
 /**
  * @brief Interpolate color between two given colors.
  */
-uint32_t EffectUtils::interpolateColor(uint32_t color1, uint32_t color2, int step, int steps) {
-    uint8_t r = map(step, 0, steps, static_cast<uint8_t>((color1 >> 16) & 0xFF), static_cast<uint8_t>((color2 >> 16) & 0xFF));
-    uint8_t g = map(step, 0, steps, static_cast<uint8_t>((color1 >> 8) & 0xFF), static_cast<uint8_t>((color2 >> 8) & 0xFF));
-    uint8_t b = map(step, 0, steps, static_cast<uint8_t>(color1 & 0xFF), static_cast<uint8_t>(color2 & 0xFF));
-    return Adafruit_NeoPixel::Color(r, g, b);
+RgbColor EffectUtils::interpolateColor(RgbColor color1, RgbColor color2, int step, int steps) {
+    uint8_t r = map(step, 0, steps, color1.red, color2.red);
+    uint8_t g = map(step, 0, steps, color1.green, color2.green);
+    uint8_t b = map(step, 0, steps, color1.blue, color2.blue);
+    return {r, g, b};
 }
 
 /**
  * @brief Convert HSV color to RGB.
+ * @details Looks the hue up in the precomputed hue table, then pulls it towards white by the missing saturation and
+ * scales it by the value.
  */
-uint32_t EffectUtils::HSVtoRGB(int hue, int saturation, int value) {
-    int chroma = (value * saturation) / 255;
-    int h = hue / 43; // sector 0 to 5
-    int x = chroma * (1 - abs((h % 2) - 1));
-    int r, g, b;
-
-    switch (h) {
-        case 0: r = chroma; g = x; b = 0; break;
-        case 1: r = x; g = chroma; b = 0; break;
-        case 2: r = 0; g = chroma; b = x; break;
-        case 3: r = 0; g = x; b = chroma; break;
-        case 4: r = x; g = 0; b = chroma; break;
-        default: r = chroma; g = 0; b = x; break;
+RgbColor EffectUtils::HSVtoRGB(int hue, int saturation, int value) {
+    const RgbColor white(255, 255, 255);
+    RgbColor color = ColorTables::hue(static_cast<uint8_t>(hue));
+    if (saturation < 255) {
+        color = white - (white - color).scale8(static_cast<uint8_t>(saturation));
     }
-
-    int m = value - chroma;
-    r += m; g += m; b += m;
-
-    return (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | static_cast<uint32_t>(b);
+    return color.scale8(static_cast<uint8_t>(value));
 }
 
 /**
@@ -57,32 +49,15 @@ int EffectUtils::mapRange(int value, int fromLow, int fromHigh, int toLow, int t
 /**
  * @brief Generate color based on wheel position for the rainbow effect.
  */
-uint32_t EffectUtils::Wheel(byte wheelPos) {
-    wheelPos = 255 - wheelPos;
-    if (wheelPos < 85) {
-        return ((255 - wheelPos * 3) << 16) | (wheelPos * 3);
-    } else if (wheelPos < 170) {
-        wheelPos -= 85;
-        return (wheelPos * 3) | ((255 - wheelPos * 3) << 8);
-    } else {
-        wheelPos -= 170;
-        return ((wheelPos * 3) << 16) | (255 - wheelPos * 3);
-    }
+RgbColor EffectUtils::Wheel(byte wheelPos) {
+    return ColorTables::wheel(wheelPos);
 }
 
 /**
  * @brief Apply brightness to a given color.
  */
-uint32_t EffectUtils::applyBrightness(uint32_t color, int brightness) {
-    uint8_t r = (color >> 16) & 0xFF;
-    uint8_t g = (color >> 8) & 0xFF;
-    uint8_t b = color & 0xFF;
-
-    r = (r * brightness) / 255;
-    g = (g * brightness) / 255;
-    b = (b * brightness) / 255;
-
-    return Adafruit_NeoPixel::Color(r, g, b);
+RgbColor EffectUtils::applyBrightness(RgbColor color, uint8_t brightness) {
+    return color.scale8(brightness);
 }
 
 /**
@@ -95,6 +70,12 @@ short EffectUtils::sampleBuffer[256];
  */
 volatile int EffectUtils::samplesRead;
 
+/**
+ * @brief Last gravity reading, pointing at pixel 0 until the accelerometer is first read.
+ */
+int32_t EffectUtils::lastGravityX = 4096;
+int32_t EffectUtils::lastGravityY = 0;
+
 /**
  * @brief Callback function for PDM data.
  * Reads PDM data into the sample buffer.
@@ -155,16 +136,61 @@ float EffectUtils::getInclination() {
     // Read gyroscope values
     IMU.readGyroscope(x, y, z);
 
-    // Calculate inclination on the X and Y axes
-    auto inclinationX = static_cast<float>(atan2(y, z) * RAD_TO_DEG);
-    auto inclinationY = static_cast<float>(atan2(-x, sqrt(y * y + z * z)) * RAD_TO_DEG);
+    // Scale the readings to integers, the angle only depends on their ratios
+    constexpr float readingScale = 1024.0f;
+    auto fixedX = static_cast<int32_t>(x * readingScale);
+    auto fixedY = static_cast<int32_t>(y * readingScale);
+    auto fixedZ = static_cast<int32_t>(z * readingScale);
+    auto fixedYZ = static_cast<int32_t>(sqrtf(y * y + z * z) * readingScale);
+
+    // Calculate inclination on the X and Y axes, as 16-bit angles already in the range [0, 360)
+    uint32_t inclinationX = FixedMath::atan2(fixedY, fixedZ);
+    uint32_t inclinationY = FixedMath::atan2(-fixedX, fixedYZ);
 
-    // Ensure inclination is in the range [0, 360)
-    inclinationX = static_cast<float>(fmod(inclinationX + 360, 360));
-    inclinationY = static_cast<float>(fmod(inclinationY + 360, 360));
+    // Average of inclinations on X and Y, converted to degrees
+    return static_cast<float>(inclinationX + inclinationY) * (360.0f / 131072.0f);
+}
 
-    // Average of inclinations on X and Y
-    auto inclination = static_cast<float>((inclinationX + inclinationY) / 2.0);
+/**
+ * @brief Get the gravity in the plane of the hoop.
+ * @details Assumes the board lies in the plane of the hoop, so the X and Y acceleration give the direction of gravity
+ * around it. Each reading is also kept for getDownAngle(), since reading a sample consumes it.
+ */
+bool EffectUtils::getGravity(int32_t& x, int32_t& y) {
+    float ax, ay, az;
+    if (!IMU.accelerationAvailable() || !IMU.readAcceleration(ax, ay, az)) {
+        return false;
+    }
+
+    lastGravityX = static_cast<int32_t>(ax * 4096.0f);
+    lastGravityY = static_cast<int32_t>(ay * 4096.0f);
+    x = lastGravityX;
+    y = lastGravityY;
+    return true;
+}
+
+/**
+ * @brief Get the angle around the hoop of its lowest point.
+ * @details Reads a new sample if one is pending, and otherwise falls back on the last one, which effects that follow
+ * the gravity every frame will already have taken.
+ */
+uint16_t EffectUtils::getDownAngle() {
+    int32_t x, y;
+    getGravity(x, y);
+    return FixedMath::atan2(lastGravityY, lastGravityX);
+}
+
+/**
+ * @brief Get the rotation rate of the hoop in its own plane.
+ * @details Assumes the board lies in the plane of the hoop, so the hoop spins around the Z axis of the gyroscope.
+ * Degrees per second are scaled by 65536 / 360.
+ */
+bool EffectUtils::getRotationRate(int32_t& rate) {
+    float gx, gy, gz;
+    if (!IMU.gyroscopeAvailable() || !IMU.readGyroscope(gx, gy, gz)) {
+        return false;
+    }
 
-    return inclination;
+    rate = static_cast<int32_t>(gz * (65536.0f / 360.0f));
+    return true;
 }
@@ -0,0 +1,200 @@
+/**
+ * @project OpenHoop
+ * @file FixedMath.cpp
+ * @brief Source file for the FixedMath class, containing fixed-point trigonometry and waveform functions.
+ * @details Generates a quarter-wave sine table and an arc tangent table with constexpr series at compile time, and
+ * implements the trigonometry by folding angles into the tables and interpolating between neighbouring entries.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/FixedMath.h"
+
+constexpr uint16_t FixedMath::QUARTER_TURN;
+constexpr uint16_t FixedMath::HALF_TURN;
+
+namespace {
+
+constexpr double TABLE_PI = 3.14159265358979323846;
+constexpr int TABLE_STEPS = 256;  ///< Intervals in each table, both tables holding one more entry for the end point.
+
+/**
+ * @brief Interpolation table with an entry for each end of its intervals.
+ */
+struct FixedTable {
+    uint16_t values[TABLE_STEPS + 1];  ///< Table entries.
+};
+
+/**
+ * @brief Sine of an angle between 0 and pi/2, from its Taylor series.
+ */
+constexpr double seriesSin(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Arc tangent of a ratio between 0 and 1.
+ * @details Shifts the argument by pi/4 so the series only sees values up to tan(pi/8) and converges quickly.
+ */
+constexpr double seriesAtan(double x) {
+    double offset = 0;
+    if (x > 0.41421356) {
+        x = (x - 1) / (x + 1);
+        offset = TABLE_PI / 4;
+    }
+    double power = x;
+    double sum = 0;
+    for (int n = 0; n < 30; n++) {
+        sum += (n % 2 ? -power : power) / (2 * n + 1);
+        power *= x * x;
+    }
+    return offset + sum;
+}
+
+/**
+ * @brief Generate the sine of the first quarter turn, scaled to 32767.
+ */
+constexpr FixedTable makeSineTable() {
+    FixedTable table{};
+    for (int i = 0; i <= TABLE_STEPS; i++) {
+        table.values[i] = static_cast<uint16_t>(seriesSin(i * TABLE_PI / (2 * TABLE_STEPS)) * 32767 + 0.5);
+    }
+    return table;
+}
+
+/**
+ * @brief Generate the arc tangent of ratios from 0 to 1 as 16-bit angles, ending at an eighth of a turn.
+ */
+constexpr FixedTable makeAtanTable() {
+    FixedTable table{};
+    for (int i = 0; i <= TABLE_STEPS; i++) {
+        table.values[i] = static_cast<uint16_t>(seriesAtan(static_cast<double>(i) / TABLE_STEPS) * 32768 / TABLE_PI + 0.5);
+    }
+    return table;
+}
+
+constexpr FixedTable SINE_TABLE = makeSineTable();  ///< Sine of the first quarter turn.
+constexpr FixedTable ATAN_TABLE = makeAtanTable();  ///< Arc tangent of ratios from 0 to 1.
+
+/**
+ * @brief Interpolate a table at a position with 8 fractional bits.
+ */
+uint16_t interpolate(const FixedTable& table, uint32_t position) {
+    const uint32_t index = position >> 8;
+    if (index >= TABLE_STEPS) {
+        return table.values[TABLE_STEPS];
+    }
+    const int32_t low = table.values[index];
+    const int32_t high = table.values[index + 1];
+    return static_cast<uint16_t>(low + (((high - low) * static_cast<int32_t>(position & 0xFF)) >> 8));
+}
+
+}
+
+/**
+ * @brief Sine of a 16-bit angle.
+ * @details The top two bits of the angle select the quadrant, which mirrors and negates the first quarter turn, and the
+ * remaining 14 bits give an 8.6 position within the table.
+ */
+int16_t FixedMath::sin16(uint16_t angle) {
+    uint32_t offset = angle & (QUARTER_TURN - 1);
+    if (angle & QUARTER_TURN) {
+        offset = QUARTER_TURN - offset;
+    }
+    const auto value = static_cast<int16_t>(interpolate(SINE_TABLE, offset << 2));
+    return (angle & HALF_TURN) ? -value : value;
+}
+
+/**
+ * @brief Cosine of a 16-bit angle.
+ */
+int16_t FixedMath::cos16(uint16_t angle) {
+    return sin16(angle + QUARTER_TURN);
+}
+
+/**
+ * @brief Sine of an 8-bit angle, offset to an unsigned byte.
+ */
+uint8_t FixedMath::sin8(uint8_t angle) {
+    return static_cast<uint8_t>((sin16(angle << 8) + HALF_TURN) >> 8);
+}
+
+/**
+ * @brief Cosine of an 8-bit angle, offset to an unsigned byte.
+ */
+uint8_t FixedMath::cos8(uint8_t angle) {
+    return static_cast<uint8_t>((cos16(angle << 8) + HALF_TURN) >> 8);
+}
+
+/**
+ * @brief Angle of the vector (x, y).
+ * @details Folds the vector into the first eighth of a turn, where the angle is the arc tangent of the smaller
+ * component over the larger one, then unfolds the result.
+ */
+uint16_t FixedMath::atan2(int32_t y, int32_t x) {
+    const uint32_t absX = x < 0 ? -static_cast<uint32_t>(x) : x;
+    const uint32_t absY = y < 0 ? -static_cast<uint32_t>(y) : y;
+    if (absX == 0 && absY == 0) {
+        return 0;
+    }
+
+    uint16_t angle = absY <= absX ? atanRatio(absY, absX) : QUARTER_TURN - atanRatio(absX, absY);
+    if (x < 0) {
+        angle = HALF_TURN - angle;
+    }
+    if (y < 0) {
+        angle = -angle;
+    }
+    return angle;
+}
+
+/**
+ * @brief Arc tangent of a ratio between 0 and 1.
+ * @details Both terms are shifted down to 16 bits so the 16.16 ratio fits a 32-bit division.
+ */
+uint16_t FixedMath::atanRatio(uint32_t numerator, uint32_t denominator) {
+    while (denominator > 0xFFFF) {
+        numerator >>= 1;
+        denominator >>= 1;
+    }
+    return interpolate(ATAN_TABLE, (numerator << 16) / denominator);
+}
+
+/**
+ * @brief Phase of a sawtooth beating at a given tempo.
+ * @details A beat lasts 60000 / bpm milliseconds, so the phase is timeMillis * bpm * 65536 / 60000. The factor
+ * 65536 / 60000 is approximated by 4474 / 4096; only the low bits of the product matter, so it may wrap around.
+ */
+uint16_t FixedMath::beat16(uint16_t bpm, uint32_t timeMillis) {
+    return static_cast<uint16_t>((timeMillis * bpm * 4474u) >> 12);
+}
+
+/**
+ * @brief Phase of a sawtooth beating at a given tempo.
+ */
+uint8_t FixedMath::beat8(uint16_t bpm, uint32_t timeMillis) {
+    return beat16(bpm, timeMillis) >> 8;
+}
+
+/**
+ * @brief Sine wave beating at a given tempo between two values.
+ */
+uint16_t FixedMath::beatsin16(uint16_t bpm, uint16_t low, uint16_t high, uint32_t timeMillis, uint16_t phaseOffset) {
+    const uint32_t wave = sin16(beat16(bpm, timeMillis) + phaseOffset) + HALF_TURN;
+    return low + ((wave * (high - low)) >> 16);
+}
+
+/**
+ * @brief Sine wave beating at a given tempo between two values.
+ */
+uint8_t FixedMath::beatsin8(uint16_t bpm, uint8_t low, uint8_t high, uint32_t timeMillis, uint8_t phaseOffset) {
+    const uint32_t wave = sin8(beat8(bpm, timeMillis) + phaseOffset);
+    return low + ((wave * (high - low)) >> 8);
+}
@@ -0,0 +1,154 @@
+/**
+ * @project OpenHoop
+ * @file FluidSimulation.cpp
+ * @brief Source file for the FluidSimulation class, a shallow-water simulation around the hoop.
+ * @details Implements the steps on a staggered grid: velocities first react to the slope of the surface and to gravity,
+ * then the depth flows between cells, carried from the upstream cell. Every unit of depth that leaves a cell enters its
+ * neighbour, so the volume of liquid never drifts.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/FluidSimulation.h"
+#include "../../include/utils/FixedMath.h"
+#include <stdlib.h>
+
+constexpr uint16_t FluidSimulation::MAX_CELLS;
+constexpr int16_t FluidSimulation::MAX_VELOCITY;
+constexpr int32_t TapDetector::DEFAULT_THRESHOLD;
+constexpr uint8_t TapDetector::COOLDOWN;
+
+namespace {
+
+constexpr int32_t PRESSURE = 2;  ///< Velocity lost per step for each unit of depth the surface rises to the next cell.
+constexpr uint8_t GRAVITY_SHIFT = 7;  ///< One g along the hoop adds 32 to the velocity per step.
+constexpr uint8_t DAMPING_SHIFT = 6;  ///< 1/64 of the velocity is lost per step.
+
+/**
+ * @brief Limit a velocity to the fastest stable flow.
+ */
+int16_t clampVelocity(int32_t speed) {
+    const int32_t limit = FluidSimulation::MAX_VELOCITY;
+    return static_cast<int16_t>(speed > limit ? limit : speed < -limit ? -limit : speed);
+}
+
+}
+
+/**
+ * @brief Fill every cell to the same level and stop the flow.
+ */
+void FluidSimulation::reset(uint16_t cellCount, uint16_t level) {
+    size = cellCount < MAX_CELLS ? cellCount : MAX_CELLS;
+    for (uint16_t i = 0; i < size; i++) {
+        depth[i] = level;
+        velocity[i] = 0;
+    }
+}
+
+/**
+ * @brief Advance the liquid by a step.
+ * @details The boundary after cell i sits at angle (i + 1/2) / size of a turn, where gravity pulls along the tangent
+ * (-sin a, cos a). The velocities are clamped to MAX_VELOCITY, so the flow out of both sides of a cell in a step never
+ * exceeds 3/4 of its depth, and depths stay positive without any further check.
+ */
+void FluidSimulation::step(int32_t gravityX, int32_t gravityY) {
+    if (size < 2) {
+        return;
+    }
+
+    const uint32_t angleStep = 0xFFFFFFFFUL / size;
+    uint32_t angle = angleStep / 2;
+    for (uint16_t i = 0; i < size; i++) {
+        const uint16_t next = i + 1 < size ? i + 1 : 0;
+        const auto faceAngle = static_cast<uint16_t>(angle >> 16);
+        const int32_t tangential = (gravityY * FixedMath::cos16(faceAngle) - gravityX * FixedMath::sin16(faceAngle)) >> 15;
+        const int32_t slope = static_cast<int32_t>(depth[next]) - depth[i];
+
+        int32_t speed = velocity[i] - slope * PRESSURE + (tangential >> GRAVITY_SHIFT);
+        speed -= speed >> DAMPING_SHIFT;
+        velocity[i] = clampVelocity(speed);
+        angle += angleStep;
+    }
+
+    // Carry the depth of the upstream cell across each boundary, rounding towards zero so no cell gives more than it has
+    const int32_t firstFlow = velocity[size - 1] * static_cast<int32_t>(velocity[size - 1] > 0 ? depth[size - 1] : depth[0]) / 4096;
+    int32_t inflow = firstFlow;
+    for (uint16_t i = 0; i < size; i++) {
+        const uint16_t next = i + 1 < size ? i + 1 : 0;
+        const int32_t outflow = i + 1 < size
+                                ? velocity[i] * static_cast<int32_t>(velocity[i] > 0 ? depth[i] : depth[next]) / 4096
+                                : firstFlow;
+        depth[i] = static_cast<uint16_t>(depth[i] + inflow - outflow);
+        inflow = outflow;
+    }
+}
+
+/**
+ * @brief Push the liquid away from a cell.
+ */
+void FluidSimulation::splash(uint16_t cell, int16_t strength) {
+    if (cell >= size) {
+        return;
+    }
+
+    const uint16_t previous = cell > 0 ? cell - 1 : size - 1;
+    velocity[cell] = clampVelocity(velocity[cell] + strength);
+    velocity[previous] = clampVelocity(velocity[previous] - strength);
+}
+
+/**
+ * @brief Get the depth of a cell.
+ */
+uint16_t FluidSimulation::getDepth(uint16_t cell) const {
+    return cell < size ? depth[cell] : 0;
+}
+
+/**
+ * @brief Get the total depth of all the cells.
+ */
+uint32_t FluidSimulation::getVolume() const {
+    uint32_t volume = 0;
+    for (uint16_t i = 0; i < size; i++) {
+        volume += depth[i];
+    }
+    return volume;
+}
+
+/**
+ * @brief Get the number of cells on the ring.
+ */
+uint16_t FluidSimulation::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Constructor for TapDetector.
+ */
+TapDetector::TapDetector(int32_t threshold) : threshold(threshold) {}
+
+/**
+ * @brief Filter a gravity reading and splash the liquid at its lowest cell on a tap.
+ * @details The lowest cell is the one the filtered gravity points at, where the liquid pools.
+ */
+bool TapDetector::addReading(int32_t gravityX, int32_t gravityY, FluidSimulation& fluid) {
+    const int32_t jumpX = gravityX - filteredX;
+    const int32_t jumpY = gravityY - filteredY;
+    filteredX += jumpX / 8;
+    filteredY += jumpY / 8;
+
+    if (cooldown > 0) {
+        cooldown--;
+        return false;
+    }
+
+    const int32_t jump = abs(jumpX) + abs(jumpY);
+    if (jump <= threshold) {
+        return false;
+    }
+
+    const uint16_t cell = (static_cast<uint32_t>(FixedMath::atan2(filteredY, filteredX)) * fluid.getSize()) >> 16;
+    fluid.splash(cell, static_cast<int16_t>(jump > FluidSimulation::MAX_VELOCITY ? FluidSimulation::MAX_VELOCITY : jump));
+    cooldown = COOLDOWN;
+    return true;
+}
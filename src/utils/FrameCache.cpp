@@ -0,0 +1,86 @@
+/**
+ * @project OpenHoop
+ * @file FrameCache.cpp
+ * @brief Source file for the FrameCache class, a least-recently-used cache of rendered frames.
+ * @details Implements the lookups, which scan the few cached keys, and the eviction, which replaces the frame with the
+ * oldest use stamp.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/FrameCache.h"
+#include <string.h>
+
+constexpr uint8_t FrameCache::MAX_FRAMES;
+
+/**
+ * @brief Copy a cached frame out, if there is one.
+ */
+bool FrameCache::fetch(uint32_t key, RgbColor* frame, uint16_t pixels) {
+    if (pixels != framePixels) {
+        resize(pixels);
+        return false;
+    }
+
+    for (uint8_t slot = 0; slot < count; slot++) {
+        if (keys[slot] == key) {
+            lastUse[slot] = ++clock;
+            memcpy(frame, storage + slot * framePixels, framePixels * sizeof(RgbColor));
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Cache a copy of a frame.
+ */
+void FrameCache::store(uint32_t key, const RgbColor* frame, uint16_t pixels) {
+    if (pixels != framePixels) {
+        resize(pixels);
+    }
+    if (capacity == 0) {
+        return;
+    }
+
+    uint8_t slot = count;
+    if (count < capacity) {
+        count++;
+    } else {
+        slot = 0;
+        for (uint8_t candidate = 1; candidate < count; candidate++) {
+            if (lastUse[candidate] < lastUse[slot]) {
+                slot = candidate;
+            }
+        }
+    }
+
+    keys[slot] = key;
+    lastUse[slot] = ++clock;
+    memcpy(storage + slot * framePixels, frame, framePixels * sizeof(RgbColor));
+}
+
+/**
+ * @brief Drop every cached frame.
+ */
+void FrameCache::clear() {
+    count = 0;
+}
+
+/**
+ * @brief Get the number of frames of a size that fit in the cache.
+ */
+uint8_t FrameCache::getCapacity(uint16_t pixels) {
+    const uint32_t frames = pixels > 0 ? (sizeof(storage) / sizeof(RgbColor)) / pixels : 0;
+    return frames < MAX_FRAMES ? frames : MAX_FRAMES;
+}
+
+/**
+ * @brief Clear the cache and split it into frames of a new size.
+ */
+void FrameCache::resize(uint16_t pixels) {
+    framePixels = pixels;
+    capacity = getCapacity(pixels);
+    count = 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @project OpenHoop
+ * @file Gradient.cpp
+ * @brief Source file for the Gradient class, containing gradient fills.
+ * @details Implements gradient spans as a digital differential analyzer: each channel starts as a fixed-point
+ * accumulator and adds a constant step per pixel, so the only divisions happen once per span. Perceptual spans do the
+ * same on channels encoded through a compile-time table and decode each pixel with a second table read.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/Gradient.h"
+
+namespace {
+
+/**
+ * @brief Square root by Newton's method, usable in constant expressions.
+ */
+constexpr double newtonSqrt(double x) {
+    double root = x > 1 ? x : 1;
+    for (int i = 0; i < 64; i++) {
+        root = (root + x / root) / 2;
+    }
+    return root;
+}
+
+/**
+ * @brief Cube root by Newton's method, usable in constant expressions.
+ */
+constexpr double newtonCbrt(double x) {
+    double root = x > 1 ? x : 1;
+    for (int i = 0; i < 64; i++) {
+        root = (2 * root + x / (root * root)) / 3;
+    }
+    return root;
+}
+
+constexpr int ENCODE_SIZE = 256;   ///< Entries of the encode table, one per channel value.
+constexpr int DECODE_SIZE = 1024;  ///< Entries of the decode table, indexed by the top 10 bits of an encoded value.
+
+/**
+ * @brief Perceptual value of each channel value, as 16-bit fractions.
+ */
+struct EncodeTable {
+    uint16_t values[ENCODE_SIZE];  ///< Encoded values.
+};
+
+/**
+ * @brief Channel value of each perceptual value range.
+ */
+struct DecodeTable {
+    uint8_t values[DECODE_SIZE];  ///< Decoded values.
+};
+
+/**
+ * @brief Generate the encode table.
+ * @details Raising the gamma-encoded channel to 0.75 approximates OKLab's cube root of linear light, about
+ * (s^2.2)^(1/3), without its color matrix.
+ */
+constexpr EncodeTable makeEncodeTable() {
+    EncodeTable table{};
+    for (int i = 0; i < ENCODE_SIZE; i++) {
+        const double channel = i / 255.0;
+        table.values[i] = static_cast<uint16_t>(newtonSqrt(channel) * newtonSqrt(newtonSqrt(channel)) * 65535 + 0.5);
+    }
+    return table;
+}
+
+/**
+ * @brief Generate the decode table, raising the center of each range to 4/3.
+ */
+constexpr DecodeTable makeDecodeTable() {
+    DecodeTable table{};
+    for (int i = 0; i < DECODE_SIZE; i++) {
+        const double perceptual = (i + 0.5) / DECODE_SIZE;
+        table.values[i] = static_cast<uint8_t>(perceptual * newtonCbrt(perceptual) * 255 + 0.5);
+    }
+    return table;
+}
+
+constexpr EncodeTable ENCODE_TABLE = makeEncodeTable();
+constexpr DecodeTable DECODE_TABLE = makeDecodeTable();
+
+/**
+ * @brief Fill a span interpolating the 8-bit channels, kept as 8.16 accumulators.
+ */
+void fillLinearSpan(RgbColor* pixels, uint16_t count, RgbColor start, RgbColor end) {
+    int32_t red = start.red * 65536 + 0x8000;
+    int32_t green = start.green * 65536 + 0x8000;
+    int32_t blue = start.blue * 65536 + 0x8000;
+    const int32_t redStep = (end.red - start.red) * 65536 / count;
+    const int32_t greenStep = (end.green - start.green) * 65536 / count;
+    const int32_t blueStep = (end.blue - start.blue) * 65536 / count;
+
+    for (uint16_t i = 0; i < count; i++) {
+        pixels[i] = RgbColor(red >> 16, green >> 16, blue >> 16);
+        red += redStep;
+        green += greenStep;
+        blue += blueStep;
+    }
+}
+
+/**
+ * @brief Fill a span interpolating the encoded channels, kept as 16.8 accumulators.
+ */
+void fillPerceptualSpan(RgbColor* pixels, uint16_t count, RgbColor start, RgbColor end) {
+    int32_t red = ENCODE_TABLE.values[start.red] * 256 + 0x80;
+    int32_t green = ENCODE_TABLE.values[start.green] * 256 + 0x80;
+    int32_t blue = ENCODE_TABLE.values[start.blue] * 256 + 0x80;
+    const int32_t redStep = (ENCODE_TABLE.values[end.red] - ENCODE_TABLE.values[start.red]) * 256 / count;
+    const int32_t greenStep = (ENCODE_TABLE.values[end.green] - ENCODE_TABLE.values[start.green]) * 256 / count;
+    const int32_t blueStep = (ENCODE_TABLE.values[end.blue] - ENCODE_TABLE.values[start.blue]) * 256 / count;
+
+    for (uint16_t i = 0; i < count; i++) {
+        pixels[i] = RgbColor(DECODE_TABLE.values[red >> 14], DECODE_TABLE.values[green >> 14],
+                             DECODE_TABLE.values[blue >> 14]);
+        red += redStep;
+        green += greenStep;
+        blue += blueStep;
+    }
+}
+
+}
+
+/**
+ * @brief Fill colors with a gradient between two colors.
+ */
+void Gradient::fill(RgbColor* pixels, uint16_t count, RgbColor start, RgbColor end, GradientMode mode) {
+    if (count == 0) {
+        return;
+    }
+    if (mode == GradientMode::PERCEPTUAL) {
+        fillPerceptualSpan(pixels, count, start, end);
+    } else {
+        fillLinearSpan(pixels, count, start, end);
+    }
+}
+
+/**
+ * @brief Fill colors with a gradient through several stops.
+ * @details Stop positions map onto pixels so that position 255 lands on the last pixel, and each pair of stops fills the
+ * pixels between them with one span.
+ */
+void Gradient::fill(RgbColor* pixels, uint16_t count, const GradientStop* stops, uint8_t stopCount,
+                    GradientMode mode) {
+    if (count == 0 || stopCount == 0) {
+        return;
+    }
+
+    uint16_t begin = stops[0].position * (count - 1) / 255;
+    for (uint16_t i = 0; i < begin; i++) {
+        pixels[i] = stops[0].color;
+    }
+
+    for (uint8_t stop = 0; stop + 1 < stopCount; stop++) {
+        const uint16_t end = stops[stop + 1].position * (count - 1) / 255;
+        if (end > begin) {
+            fill(pixels + begin, end - begin, stops[stop].color, stops[stop + 1].color, mode);
+            begin = end;
+        }
+    }
+
+    for (uint16_t i = begin; i < count; i++) {
+        pixels[i] = stops[stopCount - 1].color;
+    }
+}
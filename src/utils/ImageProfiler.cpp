@@ -0,0 +1,58 @@
+/**
+ * @project OpenHoop
+ * @file ImageProfiler.cpp
+ * @brief Source file for the ImageProfiler class, a benchmark of the image decoders.
+ * @details Implements the timing of the column decoding of each image shipped with the firmware.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <Arduino.h>
+#include "../../include/utils/ImageProfiler.h"
+#include "../../include/images/CupcakeImage.h"
+#include "../../include/images/FlowerImage.h"
+#include "../../include/images/LeopardPrintImage.h"
+#include "../../include/images/MushroomImage.h"
+#include "../../include/Config.h"
+
+/**
+ * @brief Decode every column of every image and print the time per pixel over Serial.
+ */
+void ImageProfiler::report() {
+    CupcakeImage cupcake(LedColor(255, 255, 255));
+    FlowerImage flower(LedColor(255, 255, 255));
+    LeopardPrintImage leopard(LedColor(255, 255, 255), LedColor(0, 0, 0));
+    MushroomImage mushroom(LedColor(255, 0, 0));
+
+    profile("Cupcake", "RLE", cupcake);
+    profile("Flower", "packed", flower);
+    profile("Leopard Print", "packed", leopard);
+    profile("Mushroom", "packed", mushroom);
+}
+
+/**
+ * @brief Time the column decoding of an image and print it over Serial.
+ * @details The decoded colors are summed into a volatile so the compiler cannot drop the decoding.
+ * @param name Name printed with the result.
+ * @param format Storage format printed with the result.
+ * @param image Image to decode.
+ */
+void ImageProfiler::profile(const char* name, const char* format, LedImage& image) {
+    volatile uint32_t checksum = 0;
+    uint32_t start = micros();
+    for (uint16_t pass = 0; pass < IMAGE_PROFILING_PASSES; pass++) {
+        for (int x = 0; x < image.width; x++) {
+            const LedColumn column = image.column(x);
+            checksum = checksum + column.pixels[column.height - 1].red;
+        }
+    }
+    uint32_t elapsed = micros() - start;
+
+    const uint32_t pixels = static_cast<uint32_t>(IMAGE_PROFILING_PASSES) * image.width * image.height;
+    Serial.print(name);
+    Serial.print(" (");
+    Serial.print(format);
+    Serial.print(") Decode Time (ns/pixel): ");
+    Serial.println(pixels ? static_cast<uint32_t>(static_cast<uint64_t>(elapsed) * 1000 / pixels) : 0);
+}
@@ -0,0 +1,106 @@
+/**
+ * @project OpenHoop
+ * @file Palette.cpp
+ * @brief Source file for the palette types, mapping 8-bit indices to colors.
+ * @details Implements palette lookups and the expansion of gradient and 16-color palettes into 256 colors, and defines
+ * the gradient palettes shipped with the effects.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/Palette.h"
+
+namespace {
+
+constexpr GradientStop OCEAN_STOPS[] = {
+        {0, RgbColor(34, 87, 122)},     // Deep blue reminiscent of tranquil ocean waves
+        {51, RgbColor(56, 163, 165)},   // Subtle greenish-blue representing serene depths
+        {102, RgbColor(87, 204, 153)},  // Vibrant emerald portraying energy and vitality
+        {153, RgbColor(128, 237, 153)}, // Fresh light green symbolizing renewal and growth
+        {204, RgbColor(199, 249, 204)}, // Soft tea green evoking a sense of calm and balance
+        {255, RgbColor(34, 87, 122)},
+};
+
+constexpr GradientStop FUNKY_STOPS[] = {
+        {0, RgbColor::fromPacked(0x008080)},    // Teal
+        {51, RgbColor::fromPacked(0xa4debf)},   // Mint
+        {102, RgbColor::fromPacked(0xef0041)},  // Magenta
+        {153, RgbColor::fromPacked(0xffe33d)},  // Yellow
+        {204, RgbColor::fromPacked(0xff5bd7)},  // Pink
+        {255, RgbColor::fromPacked(0x008080)},
+};
+
+constexpr GradientStop HEAT_STOPS[] = {
+        {0, RgbColor(0, 0, 0)},        // Cold embers
+        {102, RgbColor(255, 0, 0)},    // Red flames
+        {204, RgbColor(255, 200, 0)},  // Yellow flames
+        {255, RgbColor(255, 255, 160)}, // White-hot core
+};
+
+}
+
+const GradientPalette Palette256::OCEAN = {OCEAN_STOPS, sizeof(OCEAN_STOPS) / sizeof(OCEAN_STOPS[0])};
+const GradientPalette Palette256::FUNKY = {FUNKY_STOPS, sizeof(FUNKY_STOPS) / sizeof(FUNKY_STOPS[0])};
+const GradientPalette Palette256::HEAT = {HEAT_STOPS, sizeof(HEAT_STOPS) / sizeof(HEAT_STOPS[0])};
+
+/**
+ * @brief Get the color at an index, blending the two nearest entries.
+ */
+RgbColor Palette16::color(uint8_t index) const {
+    return RgbColor::lerp8(colors[index >> 4], colors[((index >> 4) + 1) & 15], (index & 15) << 4);
+}
+
+/**
+ * @brief Constructor for Palette256.
+ */
+Palette256::Palette256() : colors{} {}
+
+/**
+ * @brief Expand a gradient palette.
+ */
+void Palette256::load(const GradientPalette& palette, GradientMode mode) {
+    load(palette.stops, palette.count, mode);
+}
+
+/**
+ * @brief Expand a list of gradient stops, treating the 256 entries as a 256-pixel gradient.
+ */
+void Palette256::load(const GradientStop* stops, uint8_t count, GradientMode mode) {
+    Gradient::fill(colors, 256, stops, count, mode);
+}
+
+/**
+ * @brief Expand a 16-color palette.
+ */
+void Palette256::load(const Palette16& palette) {
+    for (int i = 0; i < 256; i++) {
+        colors[i] = palette.color(i);
+    }
+}
+
+/**
+ * @brief Get the color at a fractional position, blending the two nearest entries.
+ */
+RgbColor Palette256::blend(uint16_t position) const {
+    const uint8_t index = position >> 8;
+    return RgbColor::lerp8(colors[index], colors[static_cast<uint8_t>(index + 1)], position & 0xFF);
+}
+
+/**
+ * @brief Fill colors with a run through the palette.
+ */
+void Palette256::fill(RgbColor* pixels, uint16_t count, uint16_t start, uint16_t delta, bool blended) const {
+    uint16_t position = start;
+    if (blended) {
+        for (uint16_t i = 0; i < count; i++) {
+            pixels[i] = blend(position);
+            position += delta;
+        }
+    } else {
+        for (uint16_t i = 0; i < count; i++) {
+            pixels[i] = colors[position >> 8];
+            position += delta;
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @project OpenHoop
+ * @file ParticleSystem.cpp
+ * @brief Source file for the ParticleSystem class, a fixed-capacity pool of particles moving around the hoop.
+ * @details Implements the particle updates and rendering. Dead particles are replaced by the last live one, so the
+ * live particles always fill the start of the arrays and loops run over them without gaps.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/ParticleSystem.h"
+#include "../../include/utils/FixedMath.h"
+
+constexpr uint16_t ParticleSystem::CAPACITY;
+
+/**
+ * @brief Remove every particle.
+ */
+void ParticleSystem::clear() {
+    count = 0;
+}
+
+/**
+ * @brief Add a particle, unless the pool is full.
+ */
+bool ParticleSystem::spawn(uint16_t newPosition, int16_t newVelocity, uint8_t newLife, RgbColor newColor) {
+    if (count >= CAPACITY || newLife == 0) {
+        return false;
+    }
+
+    position[count] = newPosition;
+    velocity[count] = newVelocity;
+    life[count] = newLife;
+    color[count] = newColor;
+    count++;
+    return true;
+}
+
+/**
+ * @brief Move the particles by an update and remove the dead ones.
+ * @details A particle at angle a is pulled by the gravity component along the hoop's tangent (-sin a, cos a), so
+ * particles settle where the hoop is lowest. One g accelerates a particle by 16 angle units per update, which brings it
+ * from the top to the bottom in about a second at 60 updates per second, and 1/64 of the velocity is lost per update to
+ * friction. Velocities keep four fractional bits so the weak pull near the top of the hoop still adds up.
+ */
+void ParticleSystem::update(int32_t gravityX, int32_t gravityY, uint8_t decay) {
+    uint16_t i = 0;
+    while (i < count) {
+        const uint16_t angle = position[i];
+        const int32_t tangential = (gravityY * FixedMath::cos16(angle) - gravityX * FixedMath::sin16(angle)) >> 15;
+        int32_t speed = velocity[i] + (tangential >> 4);
+        speed -= speed >> 6;
+        speed = speed > INT16_MAX ? INT16_MAX : speed < -INT16_MAX ? -INT16_MAX : speed;
+
+        velocity[i] = static_cast<int16_t>(speed);
+        position[i] = angle + (velocity[i] >> 4);
+        life[i] = qsub8(life[i], decay);
+
+        if (life[i] == 0) {
+            // Move the last particle into the slot and process it next
+            count--;
+            position[i] = position[count];
+            velocity[i] = velocity[count];
+            life[i] = life[count];
+            color[i] = color[count];
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * @brief Add the particles to a frame.
+ * @details The position is scaled to a 16.16 pixel coordinate, and the particle is shared between its pixel and the
+ * next one by the fractional part, so its brightness stays constant as it moves between pixels.
+ */
+void ParticleSystem::render(RgbColor* pixels, uint16_t pixelCount) const {
+    if (pixelCount == 0) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        const uint32_t coordinate = static_cast<uint32_t>(position[i]) * pixelCount;
+        const uint16_t pixel = coordinate >> 16;
+        const uint8_t fraction = coordinate >> 8;
+        const RgbColor particle = color[i].scale8(life[i]);
+
+        pixels[pixel] += particle.scale8(255 - fraction);
+        pixels[pixel + 1 < pixelCount ? pixel + 1 : 0] += particle.scale8(fraction);
+    }
+}
+
+/**
+ * @brief Get the number of live particles.
+ */
+uint16_t ParticleSystem::getCount() const {
+    return count;
+}
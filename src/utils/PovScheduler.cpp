@@ -0,0 +1,89 @@
+/**
+ * @project OpenHoop
+ * @file PovScheduler.cpp
+ * @brief Source file for the PovScheduler class, which picks the image column to show at each angle of the hoop.
+ * @details Implements the column lookup and the measurement of how late each column is switched to: the angle the hoop
+ * turned past the edge of the column, divided by the rotation rate.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/PovScheduler.h"
+
+constexpr int32_t PovScheduler::MIN_TIMED_RATE;
+
+/**
+ * @brief Split a turn into columns and start from no column.
+ */
+void PovScheduler::reset(uint16_t columnsPerTurn) {
+    columns = columnsPerTurn > 0 ? columnsPerTurn : 1;
+    currentColumn = -1;
+    clearStats();
+}
+
+/**
+ * @brief Check whether the hoop reached another column.
+ * @details The hoop is assumed to have moved the shorter way around since the last poll, which tells the turning
+ * direction, the columns skipped in between, and which edge of the new column it crossed.
+ */
+bool PovScheduler::poll(uint32_t angle, int32_t rate, uint16_t& column) {
+    const int32_t next = columnAt(angle);
+    if (next == currentColumn) {
+        return false;
+    }
+    column = static_cast<uint16_t>(next);
+    stats.columns++;
+    if (currentColumn < 0) {
+        currentColumn = next;
+        return true;
+    }
+
+    int32_t steps = next - currentColumn;
+    if (steps > columns / 2) {
+        steps -= columns;
+    } else if (steps < -(columns / 2)) {
+        steps += columns;
+    }
+    const bool forward = steps > 0;
+    stats.missedColumns += (forward ? steps : -steps) - 1;
+    if (forward ? next < currentColumn : next > currentColumn) {
+        stats.turns++;
+    }
+    currentColumn = next;
+
+    // Edge of the new column that was crossed, the first angle of the column or the first one of the following column
+    const uint32_t edgeColumn = forward ? next : next + 1;
+    const auto edge = static_cast<uint32_t>(((static_cast<uint64_t>(edgeColumn) << 32) + columns - 1) / columns);
+    const auto late = static_cast<int32_t>(forward ? angle - edge : edge - angle);
+    const int32_t speed = rate < 0 ? -rate : rate;
+    if (speed >= MIN_TIMED_RATE && late >= 0) {
+        // An angle of 2^32 takes 10^6 / (speed * 65536) microseconds
+        const auto delay = static_cast<uint32_t>(static_cast<int64_t>(late) * 15625 / (speed * 1024LL));
+        stats.timedColumns++;
+        stats.totalDelay += delay;
+        stats.maxDelay = delay > stats.maxDelay ? delay : stats.maxDelay;
+    }
+    return true;
+}
+
+/**
+ * @brief Get the column at an angle.
+ */
+uint16_t PovScheduler::columnAt(uint32_t angle) const {
+    return static_cast<uint16_t>((static_cast<uint64_t>(angle) * columns) >> 32);
+}
+
+/**
+ * @brief Get the timing of the columns switched since the statistics were last cleared.
+ */
+const PovStats& PovScheduler::getStats() const {
+    return stats;
+}
+
+/**
+ * @brief Clear the timing statistics.
+ */
+void PovScheduler::clearStats() {
+    stats = PovStats();
+}
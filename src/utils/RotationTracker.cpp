@@ -0,0 +1,66 @@
+/**
+ * @project OpenHoop
+ * @file RotationTracker.cpp
+ * @brief Source file for the RotationTracker class, an estimate of the rotation of the hoop from its gyroscope.
+ * @details Implements the trapezoidal integration of the rotation rate and the extrapolation of the angle between
+ * readings. Angles wrap around naturally in 32 bits, so the hoop can spin for any number of turns.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "../../include/utils/RotationTracker.h"
+
+constexpr uint32_t RotationTracker::MAX_EXTRAPOLATION;
+
+/**
+ * @brief Forget the readings and restart from an angle.
+ */
+void RotationTracker::reset(uint32_t startAngle) {
+    started = false;
+    angle = startAngle;
+    lastRate = 0;
+    averageRate = 0;
+}
+
+/**
+ * @brief Add a gyroscope reading.
+ */
+void RotationTracker::addReading(int32_t rate, uint32_t time) {
+    if (started) {
+        angle += advance(static_cast<int32_t>((static_cast<int64_t>(lastRate) + rate) / 2), time - lastTime);
+        averageRate += (rate - averageRate) / 4;
+    } else {
+        averageRate = rate;
+        started = true;
+    }
+    lastRate = rate;
+    lastTime = time;
+}
+
+/**
+ * @brief Get the rotation angle at an instant, extrapolated from the last reading at its rate.
+ * @details The gyroscope is read far less often than columns change, so the angle in between relies on the rate
+ * staying steady. Extrapolation stops after MAX_EXTRAPOLATION so a stalled sensor does not spin the angle forever.
+ */
+uint32_t RotationTracker::getAngle(uint32_t time) const {
+    const uint32_t elapsed = time - lastTime;
+    // Times just before the last reading wrap around to huge durations and are not extrapolated
+    return started && elapsed <= MAX_EXTRAPOLATION ? angle + advance(lastRate, elapsed) : angle;
+}
+
+/**
+ * @brief Get the rotation rate, averaged over the last readings.
+ */
+int32_t RotationTracker::getRate() const {
+    return averageRate;
+}
+
+/**
+ * @brief Get the angle travelled at a rate over a duration.
+ * @details A rate of 65536 per second travels 2^32 per second, so the angle is rate * 65536 * duration / 10^6, which
+ * simplifies to rate * 1024 * duration / 15625.
+ */
+uint32_t RotationTracker::advance(int32_t rate, uint32_t duration) {
+    return static_cast<uint32_t>(static_cast<int64_t>(rate) * 1024 * duration / 15625);
+}
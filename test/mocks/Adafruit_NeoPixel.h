@@ -0,0 +1,76 @@
+/**
+ * @project OpenHoop
+ * @file Adafruit_NeoPixel.h
+ * @brief Host stand-in for the Adafruit NeoPixel library, for the native test environment.
+ * @details Declares the parts of Adafruit_NeoPixel that the hoop headers use, keeping the colors in memory instead of
+ * sending them to a strip, so code that includes Config.h compiles on the computer.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_MOCK_ADAFRUIT_NEOPIXEL_H
+#define OPENHOOP_MOCK_ADAFRUIT_NEOPIXEL_H
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uint16_t neoPixelType;  ///< Pixel color order and speed.
+
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))  ///< Green, red, blue color order.
+#define NEO_KHZ800 0x0000  ///< 800 kHz data stream.
+
+/**
+ * @brief In-memory strip of RGB pixels.
+ */
+class Adafruit_NeoPixel {
+public:
+    Adafruit_NeoPixel(uint16_t n, int16_t /*pin*/ = 6, neoPixelType /*type*/ = NEO_GRB + NEO_KHZ800)
+        : numLEDs(n), numBytes(n * 3), pixels(new uint8_t[n * 3]()) {}
+
+    ~Adafruit_NeoPixel() {
+        delete[] pixels;
+    }
+
+    Adafruit_NeoPixel(const Adafruit_NeoPixel&) = delete;
+    Adafruit_NeoPixel& operator=(const Adafruit_NeoPixel&) = delete;
+
+    void begin() {}
+
+    void show() {}
+
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+        if (n < numLEDs) {
+            pixels[n * 3] = r;
+            pixels[n * 3 + 1] = g;
+            pixels[n * 3 + 2] = b;
+        }
+    }
+
+    void setPixelColor(uint16_t n, uint32_t c) {
+        setPixelColor(n, static_cast<uint8_t>(c >> 16), static_cast<uint8_t>(c >> 8), static_cast<uint8_t>(c));
+    }
+
+    void clear() {
+        memset(pixels, 0, numBytes);
+    }
+
+    uint32_t getPixelColor(uint16_t n) const {
+        return n < numLEDs ? Color(pixels[n * 3], pixels[n * 3 + 1], pixels[n * 3 + 2]) : 0;
+    }
+
+    uint16_t numPixels() const {
+        return numLEDs;
+    }
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | b;
+    }
+
+protected:
+    uint16_t numLEDs;   ///< Number of pixels.
+    uint16_t numBytes;  ///< Number of bytes of the pixels.
+    uint8_t* pixels;    ///< Colors of the pixels, three bytes each.
+};
+
+#endif //OPENHOOP_MOCK_ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,44 @@
+/**
+ * @project OpenHoop
+ * @file Arduino.h
+ * @brief Host stand-in for the Arduino core, for the native test environment.
+ * @details Declares the Arduino types, macros and functions that the effect utilities use, with a Serial port that
+ * discards what is printed, so their sources compile on the computer.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_MOCK_ARDUINO_H
+#define OPENHOOP_MOCK_ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef uint8_t byte;  ///< Arduino byte type.
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+/**
+ * @brief Re-maps a number from one range to another, as the Arduino core does.
+ */
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+/**
+ * @brief Serial port that discards what is printed.
+ */
+class HardwareSerial {
+public:
+    template<typename T>
+    void print(const T&) {}
+
+    template<typename T>
+    void println(const T&) {}
+};
+
+extern HardwareSerial Serial;  ///< Serial port, defined by the test that uses it.
+
+#endif //OPENHOOP_MOCK_ARDUINO_H
@@ -0,0 +1,73 @@
+/**
+ * @project OpenHoop
+ * @file Arduino_BMI270_BMM150.h
+ * @brief Host stand-in for the Arduino BMI270 and BMM150 IMU library, for the native test environment.
+ * @details Declares an IMU whose samples are queued by the test. Like the sensor, each sample is available until it
+ * is read, and reading it consumes it.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_MOCK_ARDUINO_BMI270_BMM150_H
+#define OPENHOOP_MOCK_ARDUINO_BMI270_BMM150_H
+
+/**
+ * @brief IMU fed by the test, one pending sample per sensor.
+ */
+class BoschSensorClass {
+public:
+    /**
+     * @brief Makes an acceleration sample pending, in g.
+     */
+    void setAcceleration(float x, float y, float z) {
+        acceleration[0] = x;
+        acceleration[1] = y;
+        acceleration[2] = z;
+        accelerationPending = true;
+    }
+
+    /**
+     * @brief Makes a gyroscope sample pending, in degrees per second.
+     */
+    void setGyroscope(float x, float y, float z) {
+        gyroscope[0] = x;
+        gyroscope[1] = y;
+        gyroscope[2] = z;
+        gyroscopePending = true;
+    }
+
+    int accelerationAvailable() {
+        return accelerationPending;
+    }
+
+    int gyroscopeAvailable() {
+        return gyroscopePending;
+    }
+
+    int readAcceleration(float& x, float& y, float& z) {
+        x = acceleration[0];
+        y = acceleration[1];
+        z = acceleration[2];
+        accelerationPending = false;
+        return 1;
+    }
+
+    int readGyroscope(float& x, float& y, float& z) {
+        x = gyroscope[0];
+        y = gyroscope[1];
+        z = gyroscope[2];
+        gyroscopePending = false;
+        return 1;
+    }
+
+private:
+    float acceleration[3] = {0.0f, 0.0f, 1.0f};  ///< Last acceleration sample, in g.
+    float gyroscope[3] = {0.0f, 0.0f, 0.0f};     ///< Last gyroscope sample, in degrees per second.
+    bool accelerationPending = false;            ///< Whether the acceleration sample has not been read yet.
+    bool gyroscopePending = false;               ///< Whether the gyroscope sample has not been read yet.
+};
+
+extern BoschSensorClass IMU;  ///< IMU, defined by the test that uses it.
+
+#endif //OPENHOOP_MOCK_ARDUINO_BMI270_BMM150_H
@@ -0,0 +1,30 @@
+/**
+ * @project OpenHoop
+ * @file PDM.h
+ * @brief Host stand-in for the Arduino PDM microphone library, for the native test environment.
+ * @details Declares a microphone that never has samples to read.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_MOCK_PDM_H
+#define OPENHOOP_MOCK_PDM_H
+
+/**
+ * @brief Silent microphone.
+ */
+class PDMClass {
+public:
+    int available() {
+        return 0;
+    }
+
+    int read(void* /*buffer*/, int /*size*/) {
+        return 0;
+    }
+};
+
+extern PDMClass PDM;  ///< Microphone, defined by the test that uses it.
+
+#endif //OPENHOOP_MOCK_PDM_H
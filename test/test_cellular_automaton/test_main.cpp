@@ -0,0 +1,123 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests of the CellularAutomaton class and its rule codes.
+ * @details Steps the bit-packed automaton side by side with a cell-by-cell reference over random rules, sizes and seeds
+ * in all three modes, and checks the decoding and validation of rule codes.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include "utils/CellularAutomaton.h"
+
+namespace {
+
+CellularAutomaton automaton;
+
+/**
+ * @brief Step a rule one cell at a time, as the automaton is documented to.
+ * @param cells States of the cells, replaced by the next generation.
+ * @param size Number of cells on the ring.
+ * @param rule Rule to step with.
+ */
+void referenceStep(uint8_t* cells, uint16_t size, const AutomatonRule& rule) {
+    uint8_t next[CellularAutomaton::MAX_CELLS];
+    for (uint16_t i = 0; i < size; i++) {
+        auto alive = [&](int offset) {
+            return cells[(i + offset + 2 * size) % size] == 1 ? 1 : 0;
+        };
+
+        if (rule.states == 0) {
+            const int pattern = alive(-1) * 4 + alive(0) * 2 + alive(1);
+            next[i] = (rule.wolfram >> pattern) & 1;
+        } else if (cells[i] == 0) {
+            next[i] = (rule.birth >> (alive(-2) + alive(-1) + alive(1) + alive(2))) & 1;
+        } else if (cells[i] == 1) {
+            const bool survives = (rule.survive >> (alive(-2) + alive(-1) + alive(1) + alive(2))) & 1;
+            next[i] = survives ? 1 : rule.states > 2 ? 2 : 0;
+        } else {
+            next[i] = cells[i] + 1 < rule.states ? cells[i] + 1 : 0;
+        }
+    }
+    for (uint16_t i = 0; i < size; i++) {
+        cells[i] = next[i];
+    }
+}
+
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_matches_reference_over_random_rules() {
+    FastRandom random(9);
+    uint8_t cells[CellularAutomaton::MAX_CELLS];
+    for (uint16_t run = 0; run < 3000; run++) {
+        AutomatonRule rule;
+        rule.wolfram = random.random8();
+        rule.birth = random.random8() & 0x1F;
+        rule.survive = random.random8() & 0x1F;
+        rule.states = run % 3 == 0 ? 0 : run % 3 == 1 ? 2 : random.random8(3, CellularAutomaton::MAX_STATES + 1);
+        const uint16_t size = random.random16(1, CellularAutomaton::MAX_CELLS + 1);
+
+        automaton.reset(size, rule);
+        automaton.seedRandom(random, 100);
+        for (uint16_t i = 0; i < size; i++) {
+            cells[i] = automaton.getState(i);
+        }
+        for (uint8_t generation = 0; generation < 20; generation++) {
+            automaton.step();
+            referenceStep(cells, size, rule);
+            for (uint16_t i = 0; i < size; i++) {
+                TEST_ASSERT_EQUAL_UINT8(cells[i], automaton.getState(i));
+            }
+        }
+    }
+}
+
+void test_rule_90_grows_sierpinski_triangle() {
+    automaton.reset(64, AutomatonRule::fromCode(90));
+    automaton.seedCenter();
+    for (uint8_t generation = 0; generation < 16; generation++) {
+        automaton.step();
+    }
+    // After 16 generations only the two cells 16 away from the seed are alive
+    for (uint16_t i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL_UINT8(i == 16 || i == 48 ? 1 : 0, automaton.getState(i));
+    }
+}
+
+void test_decodes_rule_codes() {
+    const AutomatonRule rule = AutomatonRule::fromCode(0x03000C04);
+    TEST_ASSERT_EQUAL_UINT8(4, rule.wolfram);
+    TEST_ASSERT_EQUAL_UINT8(0x0C, rule.birth);
+    TEST_ASSERT_EQUAL_UINT8(0, rule.survive);
+    TEST_ASSERT_EQUAL_UINT8(3, rule.states);
+    TEST_ASSERT_EQUAL_UINT8(2, AutomatonRule::fromCode(0x01000C00).states);
+}
+
+void test_rejects_rules_without_births() {
+    TEST_ASSERT_TRUE(AutomatonRule::isValidCode(30));
+    TEST_ASSERT_TRUE(AutomatonRule::isValidCode(255));
+    TEST_ASSERT_TRUE(AutomatonRule::isValidCode(0x03000C00));
+    TEST_ASSERT_TRUE(AutomatonRule::isValidCode(0x01000C00));
+    TEST_ASSERT_TRUE(AutomatonRule::isValidCode(0x09000100));
+    TEST_ASSERT_FALSE(AutomatonRule::isValidCode(0));
+    TEST_ASSERT_FALSE(AutomatonRule::isValidCode(0x02000000));
+    TEST_ASSERT_FALSE(AutomatonRule::isValidCode(0x021F0000));
+    TEST_ASSERT_FALSE(AutomatonRule::isValidCode(0x0200E000));
+    TEST_ASSERT_FALSE(AutomatonRule::isValidCode(0x00000C00));
+    TEST_ASSERT_FALSE(AutomatonRule::isValidCode(0x0A000C00));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_reference_over_random_rules);
+    RUN_TEST(test_rule_90_grows_sierpinski_triangle);
+    RUN_TEST(test_decodes_rule_codes);
+    RUN_TEST(test_rejects_rules_without_births);
+    return UNITY_END();
+}
@@ -0,0 +1,135 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests of the ColorKernels class.
+ * @details Checks the word-parallel kernels against the per-channel RgbColor operations over every pair of channel
+ * values and every scale or alpha, including frames whose channels do not fill whole words. On the host the kernels
+ * run their portable path, the one used by targets without the Cortex-M4 DSP instructions.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include <vector>
+#include "utils/ColorKernels.h"
+
+namespace {
+
+constexpr uint16_t PAIR_COLORS = (65536 + 2) / 3;  ///< Colors holding every pair of channel values.
+
+/**
+ * @brief Frame whose channel i is the low byte of i, every channel value appearing along it.
+ */
+std::vector<RgbColor> lowBytes(uint16_t colors) {
+    std::vector<RgbColor> frame(colors);
+    auto* channels = reinterpret_cast<uint8_t*>(frame.data());
+    for (uint32_t i = 0; i < colors * 3U; i++) {
+        channels[i] = static_cast<uint8_t>(i);
+    }
+    return frame;
+}
+
+/**
+ * @brief Frame whose channel i is the second byte of i, so that with lowBytes every pair of values meets once.
+ */
+std::vector<RgbColor> highBytes(uint16_t colors) {
+    std::vector<RgbColor> frame(colors);
+    auto* channels = reinterpret_cast<uint8_t*>(frame.data());
+    for (uint32_t i = 0; i < colors * 3U; i++) {
+        channels[i] = static_cast<uint8_t>(i >> 8);
+    }
+    return frame;
+}
+
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_add_matches_saturating_sum() {
+    std::vector<RgbColor> destination = lowBytes(PAIR_COLORS);
+    const std::vector<RgbColor> source = highBytes(PAIR_COLORS);
+    const std::vector<RgbColor> original = destination;
+    ColorKernels::add(destination.data(), source.data(), PAIR_COLORS);
+    for (uint16_t i = 0; i < PAIR_COLORS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(RgbColor(original[i] + source[i]).packed(), destination[i].packed());
+    }
+}
+
+void test_subtract_matches_saturating_difference() {
+    std::vector<RgbColor> destination = lowBytes(PAIR_COLORS);
+    const std::vector<RgbColor> source = highBytes(PAIR_COLORS);
+    const std::vector<RgbColor> original = destination;
+    ColorKernels::subtract(destination.data(), source.data(), PAIR_COLORS);
+    for (uint16_t i = 0; i < PAIR_COLORS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(RgbColor(original[i] - source[i]).packed(), destination[i].packed());
+    }
+}
+
+void test_scale_matches_scale8() {
+    const std::vector<RgbColor> original = lowBytes(86);
+    for (int scale = 0; scale < 256; scale++) {
+        std::vector<RgbColor> frame = original;
+        ColorKernels::scale(frame.data(), 86, static_cast<uint8_t>(scale));
+        for (uint16_t i = 0; i < 86; i++) {
+            TEST_ASSERT_EQUAL_UINT32(original[i].scale8(static_cast<uint8_t>(scale)).packed(), frame[i].packed());
+        }
+    }
+}
+
+void test_fade_to_black_is_the_inverse_scale() {
+    const std::vector<RgbColor> original = lowBytes(86);
+    for (int amount = 0; amount < 256; amount++) {
+        std::vector<RgbColor> frame = original;
+        ColorKernels::fadeToBlack(frame.data(), 86, static_cast<uint8_t>(amount));
+        for (uint16_t i = 0; i < 86; i++) {
+            const RgbColor expected = original[i].scale8(static_cast<uint8_t>(255 - amount));
+            TEST_ASSERT_EQUAL_UINT32(expected.packed(), frame[i].packed());
+        }
+    }
+}
+
+void test_blend_matches_weighted_average() {
+    const std::vector<RgbColor> original = lowBytes(PAIR_COLORS);
+    const std::vector<RgbColor> source = highBytes(PAIR_COLORS);
+    for (int alpha = 0; alpha < 256; alpha++) {
+        std::vector<RgbColor> destination = original;
+        ColorKernels::blend(destination.data(), source.data(), PAIR_COLORS, static_cast<uint8_t>(alpha));
+
+        const int weight = alpha + (alpha >> 7);
+        const auto* a = reinterpret_cast<const uint8_t*>(original.data());
+        const auto* b = reinterpret_cast<const uint8_t*>(source.data());
+        const auto* result = reinterpret_cast<const uint8_t*>(destination.data());
+        for (uint32_t i = 0; i < PAIR_COLORS * 3U; i++) {
+            TEST_ASSERT_EQUAL_UINT8((a[i] * (256 - weight) + b[i] * weight) >> 8, result[i]);
+        }
+    }
+    std::vector<RgbColor> copied = original;
+    ColorKernels::blend(copied.data(), source.data(), PAIR_COLORS, 255);
+    TEST_ASSERT_EQUAL_MEMORY(source.data(), copied.data(), PAIR_COLORS * 3);
+}
+
+void test_partial_words_leave_neighbours_untouched() {
+    for (uint16_t count = 1; count <= 5; count++) {
+        std::vector<RgbColor> frame(count + 1, RgbColor(200, 200, 200));
+        const std::vector<RgbColor> source(count + 1, RgbColor(100, 100, 100));
+        ColorKernels::add(frame.data(), source.data(), count);
+        for (uint16_t i = 0; i < count; i++) {
+            TEST_ASSERT_EQUAL_UINT32(RgbColor(255, 255, 255).packed(), frame[i].packed());
+        }
+        TEST_ASSERT_EQUAL_UINT32(RgbColor(200, 200, 200).packed(), frame[count].packed());
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_add_matches_saturating_sum);
+    RUN_TEST(test_subtract_matches_saturating_difference);
+    RUN_TEST(test_scale_matches_scale8);
+    RUN_TEST(test_fade_to_black_is_the_inverse_scale);
+    RUN_TEST(test_blend_matches_weighted_average);
+    RUN_TEST(test_partial_words_leave_neighbours_untouched);
+    return UNITY_END();
+}
@@ -0,0 +1,90 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests of EffectUtils::getDownAngle(), which stabilized effects start from.
+ * @details Builds EffectUtils against the IMU stand-in, which like the sensor consumes each sample when it is read.
+ * Effects such as FIRE, SPARKS and FLUID read the gravity every frame, so when the hoop switches from one of them to a
+ * stabilized effect there is usually no sample left to read, and the lowest point must come from the last one taken.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include "../../src/utils/EffectUtils.cpp"
+
+BoschSensorClass IMU;
+PDMClass PDM;
+HardwareSerial Serial;
+
+namespace {
+
+constexpr uint16_t QUARTER_TURN = 16384;  ///< Binary angle of a quarter turn.
+constexpr uint16_t TOLERANCE = 64;        ///< Error allowed on an angle, about a third of a degree.
+
+/**
+ * @brief Run frames of an effect that follows the gravity, reading it the way FireEffect and FluidEffect do.
+ * @param frames Number of frames to run.
+ */
+void runGravityEffect(uint8_t frames) {
+    int32_t x, y;
+    for (uint8_t i = 0; i < frames; i++) {
+        EffectUtils::getGravity(x, y);
+    }
+}
+
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+/**
+ * @brief Before the accelerometer is ever read, the lowest point is pixel 0.
+ * @details Runs first, since the last reading is kept for the whole program.
+ */
+void test_down_angle_before_any_reading() {
+    TEST_ASSERT_EQUAL_UINT16(0, EffectUtils::getDownAngle());
+}
+
+/**
+ * @brief A pending sample is read and gives the lowest point.
+ */
+void test_down_angle_reads_a_pending_sample() {
+    IMU.setAcceleration(0.0f, 1.0f, 0.0f);
+    TEST_ASSERT_INT_WITHIN(TOLERANCE, QUARTER_TURN, EffectUtils::getDownAngle());
+    TEST_ASSERT_FALSE(IMU.accelerationAvailable());
+}
+
+/**
+ * @brief Switching from an effect that consumed the samples starts from the last one it read.
+ */
+void test_down_angle_after_a_gravity_effect() {
+    IMU.setAcceleration(-1.0f, 0.0f, 0.0f);
+    runGravityEffect(1);
+    IMU.setAcceleration(0.0f, -1.0f, 0.0f);
+    runGravityEffect(3);
+    TEST_ASSERT_FALSE(IMU.accelerationAvailable());
+
+    TEST_ASSERT_INT_WITHIN(TOLERANCE, 3 * QUARTER_TURN, EffectUtils::getDownAngle());
+}
+
+/**
+ * @brief A sample arriving after the effect stopped is preferred over the last one it read.
+ */
+void test_down_angle_prefers_a_new_sample() {
+    IMU.setAcceleration(0.0f, -1.0f, 0.0f);
+    runGravityEffect(1);
+    IMU.setAcceleration(-0.7071f, -0.7071f, 0.0f);
+
+    TEST_ASSERT_INT_WITHIN(TOLERANCE, 5 * QUARTER_TURN / 2, EffectUtils::getDownAngle());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_down_angle_before_any_reading);
+    RUN_TEST(test_down_angle_reads_a_pending_sample);
+    RUN_TEST(test_down_angle_after_a_gravity_effect);
+    RUN_TEST(test_down_angle_prefers_a_new_sample);
+    return UNITY_END();
+}
@@ -0,0 +1,89 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests of the FastRandom class.
+ * @details Checks that a seed always gives the same sequence, that it is the xorshift32 sequence published by
+ * Marsaglia, and that the range draws stay within their bounds and reach every value.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include "utils/FastRandom.h"
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_seed_gives_reference_sequence() {
+    FastRandom random(1);
+    const uint32_t expected[] = {270369, 67634689, 2647435461U, 307599695, 2398689233U};
+    for (uint32_t value : expected) {
+        TEST_ASSERT_EQUAL_UINT32(value, random.next());
+    }
+}
+
+void test_zero_seed_uses_default_seed() {
+    FastRandom zero(0);
+    FastRandom fallback;
+    TEST_ASSERT_EQUAL_HEX32(0x510C4619, fallback.next());
+    TEST_ASSERT_EQUAL_HEX32(0x510C4619, zero.next());
+}
+
+void test_reseeding_replays_the_sequence() {
+    FastRandom random(1234);
+    uint16_t first[64];
+    for (uint16_t& value : first) {
+        value = random.random16();
+    }
+    random.seed(1234);
+    for (uint16_t value : first) {
+        TEST_ASSERT_EQUAL_UINT16(value, random.random16());
+    }
+}
+
+void test_random8_ranges_stay_in_bounds_and_reach_every_value() {
+    FastRandom random(42);
+    for (uint16_t limit = 1; limit <= 256; limit++) {
+        bool seen[256] = {};
+        for (int i = 0; i < 64 * limit; i++) {
+            const uint8_t value = random.random8(limit);
+            TEST_ASSERT_LESS_THAN(limit, value);
+            seen[value] = true;
+        }
+        for (uint16_t value = 0; value < limit; value++) {
+            TEST_ASSERT_TRUE(seen[value]);
+        }
+    }
+    for (int i = 0; i < 1000; i++) {
+        const uint8_t value = random.random8(10, 20);
+        TEST_ASSERT_GREATER_OR_EQUAL(10, value);
+        TEST_ASSERT_LESS_THAN(20, value);
+    }
+}
+
+void test_random16_ranges_stay_in_bounds() {
+    FastRandom random(7);
+    const uint32_t limits[] = {1, 2, 288, 1000, 65535, 65536};
+    for (uint32_t limit : limits) {
+        for (int i = 0; i < 10000; i++) {
+            TEST_ASSERT_LESS_THAN(limit, random.random16(limit));
+        }
+    }
+    for (int i = 0; i < 10000; i++) {
+        const uint16_t value = random.random16(100, 388);
+        TEST_ASSERT_GREATER_OR_EQUAL(100, value);
+        TEST_ASSERT_LESS_THAN(388, value);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_seed_gives_reference_sequence);
+    RUN_TEST(test_zero_seed_uses_default_seed);
+    RUN_TEST(test_reseeding_replays_the_sequence);
+    RUN_TEST(test_random8_ranges_stay_in_bounds_and_reach_every_value);
+    RUN_TEST(test_random16_ranges_stay_in_bounds);
+    return UNITY_END();
+}
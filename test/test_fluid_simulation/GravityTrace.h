@@ -0,0 +1,359 @@
+/**
+ * @project OpenHoop
+ * @file GravityTrace.h
+ * @brief Accelerometer trace replayed by the fluid simulation tests.
+ * @details Gravity in the plane of the hoop as EffectUtils::getGravity returns it, 4096 per g, sampled at 100 Hz for
+ * 20 seconds. The trace was generated from a model of the motion rather than captured on a hoop: 3 s held still, 5 s
+ * turned once around in the hands, 4 s swung by 60 degrees either way at 1.5 Hz, then 8 s spun up to 1.5 turns per
+ * second with centripetal noise. Four samples carry a tap. The sensor noise is 60 units.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_GRAVITYTRACE_H
+#define OPENHOOP_GRAVITYTRACE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Gravity readings, X then Y.
+ */
+const int16_t GRAVITY_TRACE[][2] = {
+        {4144, -9}, {4122, -45}, {4022, -102}, {4016, 83}, {4167, 34}, {4013, 44},
+        {4079, -225}, {4094, 65}, {4160, -66}, {4090, -55}, {4124, -36}, {4144, -81},
+        {4104, 63}, {4065, -2}, {4127, 28}, {4078, -47}, {4101, -55}, {4114, -76},
+        {4074, -45}, {4029, 16}, {4116, 15}, {4029, 19}, {4105, 69}, {4088, -72},
+        {4034, 122}, {4149, -70}, {4141, -24}, {4099, 70}, {4153, 35}, {4096, -68},
+        {4149, 84}, {3946, -74}, {4139, -51}, {4074, -32}, {4175, -32}, {4095, -122},
+        {3966, 58}, {4028, 10}, {4174, 18}, {4178, 12}, {4141, 27}, {4071, -33},
+        {4088, 69}, {4075, 23}, {4087, -32}, {4126, 88}, {4074, -20}, {4080, 98},
+        {4136, 12}, {4148, 70}, {4035, 11}, {4099, -103}, {3989, 148}, {4036, 57},
+        {4024, -13}, {4160, -33}, {4157, -27}, {4145, 76}, {4124, -10}, {4003, -38},
+        {4044, 113}, {4146, 22}, {4164, -61}, {4099, 4}, {4024, -22}, {4015, -68},
+        {4072, 65}, {4080, -110}, {3972, 93}, {4173, 5}, {4049, -28}, {4167, 118},
+        {4082, -36}, {4150, 21}, {4165, -12}, {4069, 30}, {4116, 53}, {3977, -55},
+        {4130, 7}, {4102, 132}, {4032, -28}, {4079, 85}, {4044, -8}, {4087, -17},
+        {3991, -34}, {4074, 112}, {4129, 66}, {4075, -77}, {4174, 105}, {4062, -80},
+        {4014, 29}, {4064, -220}, {4101, -65}, {4030, 105}, {4087, 60}, {4146, 40},
+        {4117, -35}, {4168, 126}, {4188, 5}, {4104, -120}, {4069, 64}, {4163, 107},
+        {4084, -3}, {4137, 34}, {4076, -6}, {4027, 56}, {4052, -16}, {4083, -61},
+        {4083, -25}, {4098, -43}, {4160, 114}, {3979, 21}, {4056, -52}, {4036, -56},
+        {4178, -26}, {4209, 104}, {4108, -31}, {4083, 35}, {4112, 13}, {4048, -123},
+        {4033, -26}, {4084, 43}, {4051, 5}, {4150, -49}, {4029, -35}, {4106, 81},
+        {4107, 64}, {4179, 44}, {4094, 30}, {4162, -23}, {4168, -88}, {4086, 62},
+        {4186, -13}, {4049, 47}, {4067, -77}, {4112, 15}, {4197, 46}, {4045, 20},
+        {4108, -87}, {4003, 66}, {4135, -7}, {4146, 163}, {4068, 145}, {4043, 19},
+        {4070, 9}, {4092, -9}, {4217, 6}, {4051, -1}, {4047, 62}, {4084, 81},
+        {4078, -14}, {3958, 43}, {4082, 10}, {4109, 71}, {4101, 8}, {4153, 21},
+        {4140, -17}, {4097, -48}, {4053, -36}, {4199, 30}, {4064, 155}, {4130, -3},
+        {4151, -151}, {4049, -26}, {4166, -30}, {4141, -24}, {4172, 135}, {4094, -16},
+        {4041, 56}, {4100, -75}, {4098, -74}, {4083, -51}, {4058, 41}, {4035, 92},
+        {4084, 28}, {4115, 58}, {4073, -62}, {4114, 18}, {4117, 41}, {4256, -23},
+        {4078, -29}, {4046, 10}, {4040, 42}, {4045, 6}, {4135, -42}, {4097, -20},
+        {4110, 34}, {4090, 41}, {4109, -19}, {4136, 23}, {4150, 18}, {4092, 1},
+        {4203, -20}, {4114, -22}, {4005, -49}, {4091, -42}, {3988, -14}, {4061, -18},
+        {4093, 47}, {4103, -12}, {4085, -72}, {4075, -18}, {4114, -15}, {4106, 17},
+        {4062, 77}, {4094, 85}, {4119, 83}, {4200, -79}, {4035, -86}, {4159, 2},
+        {4203, 1}, {4067, 78}, {4049, 58}, {4147, -81}, {4075, -31}, {4178, -78},
+        {4164, -29}, {4095, 20}, {4062, 25}, {4113, 69}, {4099, 64}, {4104, 32},
+        {4000, -40}, {4034, 50}, {4168, 8}, {4006, -61}, {4030, 24}, {4150, -47},
+        {4062, -42}, {4044, -21}, {4095, -27}, {4152, -32}, {4146, 19}, {4114, 43},
+        {4185, -54}, {3969, 87}, {4077, -49}, {4123, 30}, {4004, -85}, {4075, -91},
+        {4104, 74}, {4115, 15}, {4101, 25}, {4153, -144}, {4052, 115}, {4109, 29},
+        {4076, 68}, {4042, 7}, {4135, 54}, {4074, -1}, {4163, 49}, {4182, 8},
+        {4111, -1}, {4106, -71}, {4121, 103}, {4032, 108}, {4006, 75}, {4141, -39},
+        {4204, -38}, {4014, 57}, {4113, -8}, {3975, 134}, {4032, 56}, {4081, -32},
+        {4056, 45}, {4055, -52}, {4127, 20}, {4176, 38}, {4057, 79}, {4133, 69},
+        {4148, -72}, {4253, -29}, {4137, 114}, {4092, 24}, {4180, -61}, {4089, -47},
+        {4063, 39}, {4238, -58}, {4131, -59}, {4217, -5}, {4047, -36}, {4040, -26},
+        {4165, -3}, {4107, 23}, {4038, -79}, {4198, -61}, {4194, -5}, {4188, -14},
+        {4137, 28}, {4183, 66}, {4138, 22}, {4089, -25}, {4108, -32}, {4157, -54},
+        {4060, 95}, {4070, -43}, {4061, -9}, {4092, -38}, {4118, -17}, {4132, -30},
+        {4126, -23}, {4118, 204}, {3986, 81}, {4142, 38}, {4103, 286}, {4130, 242},
+        {4016, 297}, {4014, 364}, {4055, 312}, {4205, 438}, {3993, 428}, {3988, 621},
+        {4076, 636}, {4047, 606}, {4020, 760}, {4193, 790}, {4081, 808}, {4070, 782},
+        {3943, 978}, {4010, 979}, {4008, 1092}, {3896, 1056}, {4027, 1010}, {3883, 1188},
+        {3935, 1302}, {3946, 1330}, {3892, 1284}, {3888, 1396}, {3792, 1317}, {3781, 1397},
+        {3871, 1522}, {3755, 1626}, {3808, 1572}, {3630, 1631}, {3736, 1687}, {3604, 1822},
+        {3707, 1771}, {3705, 1840}, {3690, 1880}, {3643, 1931}, {3605, 1980}, {3484, 2025},
+        {3555, 2112}, {3506, 2020}, {3521, 2037}, {3428, 2220}, {3431, 2227}, {3418, 2277},
+        {3375, 2385}, {3377, 2442}, {3386, 2395}, {3283, 2474}, {3151, 2440}, {3228, 2531},
+        {3146, 2683}, {3207, 2676}, {2969, 2625}, {3117, 2666}, {2994, 2650}, {3008, 2708},
+        {3025, 2792}, {3046, 2816}, {2916, 2858}, {2805, 2986}, {2867, 2999}, {2721, 3026},
+        {2674, 3081}, {2724, 3069}, {2580, 3098}, {2619, 3089}, {2693, 3183}, {2637, 3174},
+        {2457, 3204}, {2572, 3372}, {2409, 3285}, {2498, 3323}, {2449, 3375}, {2255, 3429},
+        {2276, 3363}, {2207, 3445}, {2261, 3475}, {2192, 3503}, {2117, 3572}, {1984, 3506},
+        {2049, 3622}, {2021, 3638}, {1898, 3446}, {1895, 3591}, {1878, 3613}, {1783, 3565},
+        {1828, 3730}, {1757, 3707}, {1621, 3786}, {1615, 3701}, {1600, 3836}, {1556, 3784},
+        {1453, 3736}, {1248, 3920}, {1339, 3932}, {1293, 3986}, {1137, 3923}, {1324, 3899},
+        {1216, 3864}, {1132, 3949}, {1103, 3894}, {1099, 4068}, {1017, 4020}, {834, 3941},
+        {953, 4013}, {700, 4022}, {863, 3977}, {776, 4030}, {694, 4084}, {680, 3962},
+        {629, 4060}, {418, 4090}, {510, 4053}, {449, 4144}, {238, 4027}, {304, 4145},
+        {238, 4115}, {233, 4169}, {104, 4126}, {67, 4123}, {184, 4027}, {9, 4062},
+        {-51, 4114}, {-136, 4100}, {-184, 3950}, {-140, 4129}, {-257, 3995}, {-353, 4106},
+        {-347, 4129}, {-375, 4137}, {-452, 4055}, {-482, 4030}, {-614, 4095}, {-624, 4091},
+        {-601, 4033}, {-682, 4079}, {-730, 3935}, {-719, 4052}, {-905, 3963}, {-915, 4018},
+        {-897, 3956}, {-955, 4019}, {-998, 3979}, {-1158, 3997}, {-1258, 3897}, {-1214, 3938},
+        {-1281, 3922}, {-1290, 3843}, {-1497, 3877}, {-1463, 3803}, {-1465, 3806}, {-1570, 3899},
+        {-1594, 3746}, {-1650, 3678}, {-1677, 3744}, {-1667, 3699}, {-1885, 3687}, {-1779, 3739},
+        {-1882, 3637}, {-1845, 3701}, {-2046, 3541}, {-2011, 3567}, {-2106, 3644}, {-2039, 3579},
+        {-2137, 3565}, {-2133, 3484}, {-2066, 3510}, {-2143, 3436}, {-2288, 3345}, {-2331, 3415},
+        {-2325, 3333}, {-2431, 3292}, {-2494, 3235}, {-2422, 3299}, {-2564, 3151}, {-2579, 3227},
+        {-2574, 3084}, {-2636, 3188}, {-2630, 3018}, {-2684, 3043}, {-2855, 3050}, {-2758, 2915},
+        {-2804, 2989}, {-2858, 2908}, {-2973, 2915}, {-2892, 2834}, {-3011, 2815}, {-3017, 2825},
+        {-3020, 2862}, {-3104, 2624}, {-2998, 2639}, {-3108, 2539}, {-3250, 2598}, {-3228, 2609},
+        {-3277, 2545}, {-3316, 2507}, {1691, -481}, {-3273, 2315}, {-3451, 2234}, {-3391, 2261},
+        {-3411, 2209}, {-3390, 2222}, {-3504, 2178}, {-3542, 2118}, {-3510, 2097}, {-3560, 2005},
+        {-3586, 1972}, {-3549, 1943}, {-3660, 1859}, {-3725, 1836}, {-3634, 1755}, {-3879, 1796},
+        {-3692, 1780}, {-3731, 1663}, {-3818, 1677}, {-3749, 1642}, {-3681, 1462}, {-3871, 1484},
+        {-3830, 1404}, {-3846, 1316}, {-3886, 1267}, {-4027, 1231}, {-3968, 1209}, {-3940, 1248},
+        {-3882, 1024}, {-3908, 1048}, {-3891, 1033}, {-4012, 880}, {-4037, 903}, {-4098, 832},
+        {-4061, 818}, {-3916, 754}, {-4029, 715}, {-4067, 729}, {-4027, 677}, {-4058, 553},
+        {-4049, 593}, {-4085, 495}, {-4135, 405}, {-4095, 392}, {-4095, 289}, {-3980, 360},
+        {-3999, 201}, {-4033, 233}, {-4063, 170}, {-4049, 52}, {-4030, -31}, {-4134, 14},
+        {-4212, -186}, {-4110, -194}, {-4044, -266}, {-4085, -167}, {-4081, -305}, {-4049, -300},
+        {-4109, -499}, {-4051, -354}, {-4152, -578}, {-4118, -631}, {-4048, -598}, {-3985, -631},
+        {-3998, -676}, {-4101, -737}, {-3924, -814}, {-3914, -740}, {-3960, -956}, {-4035, -934},
+        {-4059, -1022}, {-4005, -995}, {-4015, -1136}, {-3892, -1176}, {-3934, -1242}, {-3867, -1235},
+        {-3860, -1385}, {-3872, -1298}, {-3824, -1411}, {-3944, -1446}, {-3799, -1576}, {-3741, -1616},
+        {-3786, -1573}, {-3770, -1699}, {-3685, -1692}, {-3755, -1845}, {-3642, -1826}, {-3686, -1810},
+        {-3651, -1887}, {-3548, -1910}, {-3507, -2003}, {-3537, -1964}, {-3531, -2110}, {-3596, -2115},
+        {-3464, -2207}, {-3577, -2223}, {-3370, -2328}, {-3345, -2312}, {-3364, -2335}, {-3375, -2341},
+        {-3337, -2387}, {-3331, -2423}, {-3337, -2470}, {-3232, -2534}, {-3225, -2634}, {-3183, -2735},
+        {-3107, -2672}, {-3023, -2686}, {-2987, -2620}, {-3027, -2799}, {-3065, -2860}, {-2874, -2956},
+        {-2952, -2893}, {-2841, -2895}, {-2855, -2922}, {-2814, -2973}, {-2868, -3108}, {-2726, -3076},
+        {-2731, -3122}, {-2659, -3099}, {-2623, -3128}, {-2534, -3239}, {-2609, -3284}, {-2598, -3277},
+        {-2420, -3289}, {-2400, -3261}, {-2407, -3335}, {-2285, -3339}, {-2340, -3425}, {-2296, -3443},
+        {-2257, -3340}, {-2122, -3433}, {-2044, -3500}, {-2059, -3600}, {-2169, -3699}, {-1936, -3605},
+        {-1923, -3614}, {-1888, -3700}, {-1815, -3524}, {-1840, -3653}, {-1779, -3770}, {-1691, -3744},
+        {-1533, -3608}, {-1591, -3785}, {-1677, -3733}, {-1520, -3789}, {-1383, -3883}, {-1397, -3842},
+        {-1297, -3906}, {-1289, -3881}, {-1359, -3863}, {-1209, -3927}, {-1211, -3879}, {-1128, -4032},
+        {-1167, -3918}, {-1071, -4023}, {-990, -3971}, {-1027, -3916}, {-875, -4011}, {-739, -4014},
+        {-774, -3917}, {-655, -4028}, {-693, -4157}, {-679, -4150}, {-630, -4000}, {-551, -4095},
+        {-439, -4155}, {-472, -4072}, {-395, -4047}, {-288, -4169}, {-182, -4223}, {-331, -4144},
+        {-100, -4159}, {-80, -4077}, {-99, -4082}, {-80, -4107}, {-10, -4104}, {82, -4094},
+        {92, -3986}, {193, -4177}, {208, -4109}, {300, -4121}, {338, -4032}, {433, -4053},
+        {491, -4069}, {527, -4008}, {629, -4041}, {669, -3978}, {646, -4042}, {675, -3963},
+        {774, -4011}, {878, -4011}, {862, -3965}, {966, -3920}, {872, -3861}, {1039, -3986},
+        {1089, -3805}, {1121, -3901}, {1252, -3884}, {1252, -3898}, {1362, -3786}, {1228, -3841},
+        {1304, -3924}, {1370, -3833}, {1590, -3816}, {1364, -3727}, {1508, -3721}, {1594, -3814},
+        {1630, -3707}, {1801, -3710}, {1748, -3722}, {1736, -3644}, {1884, -3569}, {1900, -3542},
+        {1933, -3512}, {1914, -3489}, {1958, -3520}, {2025, -3491}, {2157, -3528}, {2130, -3456},
+        {2240, -3513}, {2270, -3384}, {2323, -3368}, {2409, -3334}, {2319, -3350}, {2459, -3289},
+        {2416, -3252}, {2492, -3239}, {2436, -3158}, {2559, -3204}, {2544, -3212}, {2611, -3117},
+        {2701, -3114}, {2675, -2982}, {2798, -3127}, {2775, -3012}, {2793, -2957}, {2861, -2973},
+        {2934, -2804}, {3007, -2839}, {2991, -2822}, {3040, -2720}, {3076, -2765}, {2981, -2766},
+        {3079, -2716}, {3267, -2673}, {3182, -2528}, {3157, -2531}, {3285, -2549}, {3340, -2381},
+        {3182, -2502}, {3206, -2420}, {3416, -2330}, {3509, -2247}, {3337, -2243}, {3472, -2052},
+        {3465, -2105}, {3483, -2112}, {3645, -2083}, {3578, -2012}, {3468, -1959}, {3634, -1799},
+        {3629, -1934}, {3702, -1787}, {3634, -1858}, {3751, -1843}, {3767, -1763}, {3821, -1606},
+        {3683, -1560}, {3792, -1475}, {3822, -1545}, {3862, -1467}, {3847, -1396}, {3869, -1354},
+        {3901, -1374}, {3831, -1358}, {3848, -1236}, {3862, -1200}, {3979, -1130}, {3852, -1023},
+        {3953, -1000}, {3972, -1016}, {3999, -870}, {3958, -838}, {3975, -841}, {4056, -739},
+        {4089, -650}, {3970, -693}, {4096, -584}, {3918, -467}, {4210, -521}, {4066, -563},
+        {4206, -303}, {4058, -383}, {4023, -271}, {4117, -235}, {4032, -189}, {4193, -268},
+        {4248, -151}, {4017, -108}, {4105, -45}, {4060, 406}, {4091, 786}, {3899, 1182},
+        {3893, 1602}, {3727, 1875}, {3459, 2112}, {3252, 2455}, {3117, 2736}, {2839, 2900},
+        {2799, 3060}, {2548, 3238}, {2337, 3457}, {2303, 3507}, {2195, 3445}, {2096, 3526},
+        {1964, 3646}, {2105, 3509}, {2079, 3552}, {2154, 3522}, {2072, 3550}, {2437, 3400},
+        {2517, 3145}, {2549, 3035}, {2962, 3081}, {3028, 2861}, {3267, 2622}, {3414, 2191},
+        {3636, 2069}, {3699, 1601}, {3849, 1170}, {4084, 1050}, {4030, 684}, {4174, 198},
+        {4180, -195}, {4064, -654}, {3905, -1038}, {3914, -1477}, {3637, -1746}, {3563, -2092},
+        {3337, -2391}, {3204, -2625}, {2822, -2827}, {2726, -2984}, {2586, -3184}, {2399, -3336},
+        {2391, -3294}, {2218, -3460}, {2155, -3606}, {1938, -3552}, {1994, -3596}, {2173, -3516},
+        {2100, -3544}, {2264, -3500}, {2288, -3373}, {2444, -3321}, {2677, -3124}, {2946, -3010},
+        {2966, -2715}, {3150, -2644}, {3411, -2319}, {3563, -2124}, {3685, -1798}, {3690, -1424},
+        {3882, -1030}, {3925, -781}, {4098, -283}, {4069, 135}, {3970, 522}, {4026, 968},
+        {3942, 1225}, {3785, 1786}, {3585, 2015}, {3353, 2253}, {3183, 2593}, {3083, 2929},
+        {2869, 2999}, {2657, 3055}, {2399, 3258}, {2401, 3329}, {2214, 3500}, {2222, 3503},
+        {1985, 3625}, {1953, 3474}, {2081, 3640}, {1992, 3419}, {2057, 3527}, {2310, 3395},
+        {2416, 3273}, {2554, 3270}, {2643, 3220}, {3015, 2924}, {2984, 2568}, {3133, 2432},
+        {3506, 2213}, {3600, 1847}, {3720, 1439}, {3873, 1221}, {4056, 798}, {3966, 478},
+        {3998, 10}, {4010, -334}, {4080, -838}, {3901, -1184}, {3755, -1535}, {3687, -1936},
+        {3522, -2301}, {3337, -2395}, {3059, -2834}, {2851, -2898}, {2787, -3078}, {2514, -3166},
+        {2502, -3247}, {2386, -3472}, {2222, -3512}, {2016, -3447}, {2004, -3606}, {1995, -3531},
+        {1977, -3556}, {7221, -6487}, {2176, -3413}, {2342, -3333}, {2498, -3239}, {2618, -3138},
+        {2817, -2937}, {2957, -2789}, {3282, -2634}, {3458, -2323}, {3549, -2000}, {3740, -1644},
+        {3823, -1345}, {4062, -862}, {4067, -575}, {4102, -165}, {4061, 161}, {4105, 629},
+        {3922, 1000}, {3742, 1545}, {3737, 1768}, {3533, 2160}, {3369, 2477}, {3147, 2570},
+        {2981, 2803}, {2724, 3055}, {2593, 3167}, {2452, 3331}, {2189, 3476}, {2206, 3362},
+        {2030, 3449}, {2028, 3581}, {2040, 3393}, {2073, 3538}, {2153, 3589}, {2154, 3416},
+        {2287, 3456}, {2387, 3262}, {2585, 3192}, {2755, 3012}, {2921, 2798}, {3194, 2534},
+        {3358, 2329}, {3506, 1995}, {3554, 1787}, {3794, 1376}, {3961, 1151}, {4124, 749},
+        {4092, 245}, {4157, -219}, {4068, -523}, {3915, -936}, {3831, -1322}, {3650, -1595},
+        {3605, -2014}, {3501, -2187}, {3308, -2507}, {2969, -2840}, {2862, -2830}, {2655, -3149},
+        {2562, -3302}, {2311, -3421}, {2233, -3408}, {2137, -3555}, {1936, -3596}, {1960, -3546},
+        {2076, -3524}, {2047, -3531}, {2191, -3506}, {2187, -3443}, {2487, -3390}, {2528, -3189},
+        {2724, -3094}, {2884, -2956}, {3134, -2634}, {3389, -2430}, {3529, -2147}, {3612, -1815},
+        {3776, -1525}, {3924, -1230}, {4046, -818}, {4088, -400}, {4161, -10}, {4125, 383},
+        {4071, 770}, {3924, 1187}, {3845, 1513}, {3647, 1977}, {3485, 2094}, {3319, 2489},
+        {3097, 2516}, {2907, 2779}, {2771, 3003}, {2601, 3157}, {2419, 3360}, {2291, 3374},
+        {2105, 3468}, {2049, 3538}, {2066, 3519}, {2021, 3583}, {2080, 3376}, {2185, 3614},
+        {2278, 3438}, {2399, 3357}, {2483, 3260}, {2722, 3238}, {2835, 2913}, {3037, 2748},
+        {3238, 2569}, {3368, 2185}, {3620, 1964}, {3727, 1635}, {3899, 1319}, {4025, 940},
+        {3972, 512}, {4095, 109}, {4149, -239}, {3865, -722}, {4027, -963}, {3803, -1465},
+        {3572, -1796}, {3585, -2071}, {3378, -2404}, {3173, -2568}, {3078, -2806}, {2788, -2964},
+        {2590, -3275}, {2480, -3260}, {2286, -3400}, {2225, -3420}, {2097, -3662}, {2082, -3499},
+        {7032, -6542}, {1981, -3525}, {2016, -3546}, {2143, -3542}, {2299, -3453}, {2460, -3274},
+        {2644, -3144}, {2862, -3029}, {2862, -2805}, {3152, -2528}, {3314, -2439}, {3612, -1956},
+        {3651, -1742}, {3837, -1467}, {3969, -1223}, {4060, -631}, {4145, -327}, {4145, 142},
+        {4094, 529}, {3917, 929}, {3872, 1399}, {3730, 1572}, {3629, 1926}, {3436, 2203},
+        {3168, 2495}, {2909, 2684}, {2748, 2874}, {2641, 3185}, {2483, 3303}, {2376, 3328},
+        {2231, 3311}, {2211, 3461}, {2068, 3510}, {1999, 3543}, {2193, 3540}, {2184, 3456},
+        {2157, 3475}, {2298, 3351}, {2449, 3278}, {2513, 3267}, {2724, 2999}, {2943, 2982},
+        {3116, 2754}, {3222, 2522}, {3400, 2236}, {3736, 1803}, {3862, 1534}, {3936, 1137},
+        {4052, 757}, {4034, 343}, {3991, -48}, {3964, -426}, {4060, -734}, {3930, -1171},
+        {3715, -1416}, {3724, -1814}, {3432, -2231}, {3313, -2514}, {3099, -2742}, {2847, -2962},
+        {7674, -6151}, {2450, -3255}, {2312, -3352}, {2282, -3466}, {2232, -3442}, {2090, -3470},
+        {2111, -3550}, {1960, -3527}, {2059, -3528}, {2232, -3558}, {2176, -3398}, {2403, -3505},
+        {2440, -3136}, {2670, -3083}, {2835, -2887}, {3157, -2721}, {3200, -2613}, {3421, -2255},
+        {3455, -1955}, {3784, -1671}, {3778, -1258}, {3922, -967}, {4161, -454}, {4096, -144},
+        {4030, 253}, {4042, 692}, {3944, 1122}, {3823, 1436}, {3787, 1664}, {3584, 2047},
+        {3293, 2438}, {3196, 2622}, {2866, 2875}, {2784, 2992}, {2615, 3172}, {2375, 3282},
+        {2373, 3456}, {2172, 3476}, {2015, 3413}, {2102, 3567}, {2111, 3566}, {2094, 3622},
+        {2133, 3461}, {2214, 3493}, {2251, 3380}, {2427, 3269}, {2702, 3196}, {2754, 2935},
+        {2901, 2739}, {3130, 2606}, {3475, 2375}, {3528, 1989}, {3684, 1712}, {3847, 1387},
+        {3971, 1062}, {4075, 704}, {4068, 261}, {4104, -151}, {4077, -482}, {3897, -915},
+        {3965, -1344}, {3843, -1601}, {3615, -2001}, {3455, -2249}, {3246, -2610}, {3041, -2813},
+        {2804, -2911}, {2625, -3137}, {2519, -3234}, {2349, -3376}, {2260, -3502}, {2153, -3468},
+        {2183, -3552}, {2005, -3468}, {2051, -3527}, {2070, -3437}, {2161, -3494}, {2337, -3332},
+        {2381, -3244}, {2524, -3270}, {2716, -3145}, {2878, -2940}, {3130, -2654}, {3251, -2401},
+        {3462, -2237}, {3721, -1843}, {3861, -1584}, {3927, -1175}, {4049, -799}, {3993, -387},
+        {2825, -548}, {4223, -863}, {5295, -1681}, {3893, 1085}, {2618, 490}, {4350, 1339},
+        {4365, 1121}, {4895, -2935}, {5060, -972}, {4106, -887}, {3928, 95}, {4800, -612},
+        {2013, 2821}, {4301, 381}, {2128, 2160}, {6568, -1048}, {3018, 665}, {4556, -3267},
+        {6790, 2545}, {6935, 1169}, {2258, 1042}, {3486, 1696}, {3144, -1069}, {5488, 1455},
+        {4756, 1679}, {4984, 3229}, {3042, 2235}, {4996, 101}, {2320, 2984}, {3577, 2208},
+        {5157, -1022}, {3456, 3187}, {4166, 2860}, {5095, 2510}, {2210, 933}, {3437, 3715},
+        {2837, 2195}, {3914, 3790}, {5418, 1074}, {3687, -1201}, {3652, 3935}, {1586, 2084},
+        {1775, 4675}, {4368, 3254}, {2314, 5134}, {3508, 4420}, {1181, 1988}, {-432, 4754},
+        {5007, 4118}, {1049, 4230}, {4656, 849}, {-553, 4062}, {1393, 3677}, {649, 3335},
+        {3066, 4531}, {48, 4390}, {1365, 5849}, {-929, 4361}, {-1312, 4949}, {-309, 2378},
+        {-388, 5241}, {-328, 4207}, {-1312, 5570}, {-1243, 2629}, {-1679, 2583}, {-565, 6178},
+        {-2242, 3321}, {-1711, 3324}, {-2467, 2454}, {-1916, 3818}, {-1949, 3954}, {-1976, 2161},
+        {-3390, 2194}, {-2796, 2940}, {-593, 3564}, {-4378, 4238}, {-4796, 926}, {-4009, 2146},
+        {-1198, 1712}, {-4258, 1431}, {-4043, 480}, {-3479, -73}, {-7042, 1376}, {-3116, -2898},
+        {-3861, -3117}, {-3222, -1374}, {-4919, -2105}, {-5222, -1772}, {-965, -2388}, {-3078, -3262},
+        {-3087, -3704}, {-4748, -2459}, {-3888, -2573}, {-3381, -3386}, {-79, -3894}, {-817, -1571},
+        {-2259, -3598}, {2044, -4884}, {1244, -3400}, {-868, -4961}, {316, -4428}, {3365, -5074},
+        {485, -5131}, {-42, -3821}, {1092, -3030}, {2962, -2635}, {3352, -2662}, {3026, -5608},
+        {3731, -2329}, {3244, -3160}, {3727, -2095}, {4616, -3308}, {4290, -1392}, {3217, -430},
+        {5681, 846}, {2612, 2030}, {7636, 3902}, {4938, 1734}, {4950, 2933}, {2408, 1452},
+        {4441, 5224}, {4881, 1529}, {2969, 5436}, {1679, 4172}, {2620, 2329}, {2311, 5666},
+        {607, 3203}, {303, 3296}, {2733, 2903}, {-7, 2573}, {-1541, 2565}, {-1795, 4392},
+        {-1722, 4540}, {-2467, 3801}, {-4112, 3283}, {-4848, 3300}, {-2873, 1565}, {-2562, 2507},
+        {-2250, 1054}, {-4458, 2414}, {-2584, 540}, {-1621, -614}, {-3926, -1203}, {-3483, 512},
+        {-3843, -1371}, {-3693, -2746}, {-3866, -3585}, {-2982, -3189}, {-4160, -2874}, {-445, -3652},
+        {-3589, -2843}, {-2315, -1953}, {16, -4665}, {-1328, -5414}, {-1636, -4584}, {1981, -3145},
+        {-221, -3944}, {3525, -2276}, {2510, -2130}, {4426, -2112}, {3032, -702}, {3090, -2456},
+        {4184, -637}, {3468, -442}, {4315, 1956}, {5372, 1256}, {5738, 2057}, {3240, 3644},
+        {1480, 1774}, {2602, 4398}, {773, 4933}, {307, 4455}, {-2337, 3207}, {-1074, 4331},
+        {-145, 2748}, {-1408, 3645}, {-39, 4981}, {-2010, 1274}, {-3745, 3795}, {-1373, 395},
+        {-3664, 1270}, {-4946, 238}, {-4322, 1206}, {-3932, -1846}, {-4208, -704}, {-3886, -3214},
+        {-3205, -2859}, {-3795, -4037}, {-3944, -4034}, {-1805, -4809}, {-635, -4019}, {-516, -4723},
+        {440, -4239}, {592, -1712}, {3442, -4914}, {3855, -3335}, {3688, -2817}, {3198, -2336},
+        {2378, -1180}, {3199, -393}, {4428, 102}, {2960, 739}, {5875, 699}, {5189, -115},
+        {1896, 1054}, {2666, -649}, {2598, 3022}, {3555, 528}, {4914, 5656}, {3337, 4340},
+        {3850, 557}, {3160, 3971}, {2338, 3223}, {2015, 3399}, {-239, 4162}, {-158, 1971},
+        {504, 3594}, {215, 5904}, {-460, 4501}, {1687, 3404}, {512, 4270}, {-3003, 5362},
+        {-2247, 2455}, {-1743, 2806}, {-2587, 3113}, {-2531, 2252}, {-3115, 3766}, {-3838, 2737},
+        {-5698, 1004}, {-2135, 1645}, {-4489, 2810}, {-4359, 110}, {-4713, 2063}, {-3626, 1},
+        {-4494, 2455}, {-5420, -177}, {-4789, -130}, {-3028, 722}, {-2061, -2563}, {-1766, -877},
+        {-3910, -1171}, {-2129, -3968}, {-4594, -2358}, {-1774, -3988}, {-2470, -3766}, {-2036, -847},
+        {-3369, -4362}, {-571, -4917}, {-2068, -2299}, {747, -3800}, {-658, -4650}, {1227, -5869},
+        {1863, -4920}, {1852, -6180}, {1234, -5232}, {1051, -4328}, {1058, -2837}, {3419, -3675},
+        {3930, -4058}, {3442, -2101}, {2515, -2860}, {4847, -1983}, {2479, -2261}, {5162, -354},
+        {3808, -2098}, {4955, -627}, {6252, 1629}, {3556, 1061}, {2480, -366}, {4369, 209},
+        {4857, -180}, {2380, 2914}, {4250, 4408}, {1817, 2711}, {1628, 1336}, {3486, 2956},
+        {3620, 4056}, {1587, 3946}, {1330, 3201}, {3934, 3498}, {2358, 2722}, {1081, 5870},
+        {-2747, 4281}, {-2373, 2855}, {366, 2011}, {-675, 1328}, {-363, 6218}, {-1903, 4179},
+        {-2450, 2095}, {-4607, 5154}, {-3100, 1942}, {-1857, 1577}, {-2196, 3839}, {-1900, 4115},
+        {-4697, 3235}, {-2928, 2929}, {-4445, 505}, {-6092, 1293}, {-4605, 1737}, {-3552, 1238},
+        {-6453, -405}, {-5586, 123}, {-4431, -1777}, {-3260, 210}, {-2712, -1813}, {-3543, -4903},
+        {-2640, -1645}, {-2629, 58}, {-1044, -3089}, {-3501, -398}, {-3702, -2207}, {-3466, -3020},
+        {-544, -4097}, {-1625, -4425}, {-266, -4443}, {1676, -4374}, {1957, -5232}, {-70, -4735},
+        {1263, -5694}, {1894, -2271}, {2027, -4206}, {1544, -4275}, {1481, -4304}, {3435, -4125},
+        {3435, -1702}, {3810, -3979}, {2308, -2473}, {1818, -2866}, {1882, -1909}, {2438, -3046},
+        {3639, -2842}, {5378, -2739}, {6229, -32}, {1912, -576}, {5004, -2352}, {3404, 560},
+        {2115, 1065}, {4591, 614}, {5181, 1387}, {2128, 2841}, {2407, 4811}, {2794, 3798},
+        {3375, 1400}, {356, 3135}, {2947, 7039}, {3927, 3695}, {1056, 4698}, {1243, 4149},
+        {1563, 2949}, {-523, 4588}, {-1068, 5113}, {63, 2153}, {-1437, 4211}, {-2652, 3737},
+        {-1606, 4466}, {-2261, 4185}, {-2183, 3160}, {564, 3040}, {-2244, 3583}, {-1289, 2042},
+        {-3900, 1202}, {-3085, 3614}, {-3845, 1944}, {-3348, 1963}, {-4239, 581}, {-5645, 2520},
+        {-2685, -76}, {-1852, -1975}, {-4045, -1040}, {-4509, -2649}, {-4804, -1918}, {-3682, -3008},
+        {-3765, 516}, {-2714, -3591}, {-3494, -3303}, {-3431, -3193}, {-2150, -2927}, {-1347, -3018},
+        {-1130, -5409}, {4, -606}, {-1661, -4674}, {-1558, -4778}, {-488, -2811}, {-1655, -4003},
+        {1475, -2860}, {967, -6864}, {1714, -4457}, {520, -3432}, {2184, -4436}, {2007, -4228},
+        {2334, -2901}, {3676, -3500}, {141, -3003}, {1842, -3072}, {4172, -1734}, {3867, -2075},
+        {2903, -732}, {1480, 608}, {2548, -392}, {4053, -882}, {2869, 364}, {3986, -324},
+        {5012, 665}, {5180, 803}, {5967, 418}, {3959, 754}, {2792, 2828}, {3245, 4952},
+        {3460, 1395}, {1740, 5135}, {880, 3809}, {352, 4162}, {1107, 3741}, {836, 6143},
+        {1217, 6154}, {213, 5008}, {2468, 1336}, {-1580, 5385}, {1017, 6347}, {-1977, 4959},
+        {-3105, 2175}, {-2214, 3654}, {-2611, 3172}, {-3051, 3703}, {-3033, 3640}, {-1541, 1101},
+        {-3114, 4395}, {-1306, 2310}, {-2319, 374}, {-6880, 842}, {-5283, 443}, {-2951, 1722},
+        {-4643, -353}, {-3919, 836}, {-4492, -1926}, {-5458, 1921}, {-5196, -538}, {-3515, -924},
+        {-4485, -1018}, {-4937, -1572}, {-2317, -1358}, {-4394, -2261}, {-3289, -3751}, {-389, -1674},
+        {-1315, -2659}, {-463, -5341}, {-1323, -4322}, {-974, -2600}, {1131, -4783}, {-240, -1090},
+        {-2352, -2449}, {-443, -3351}, {2600, -3425}, {2433, -2485}, {2113, -4652}, {3627, -2323},
+        {3760, -5962}, {3231, -4059}, {1472, -2813}, {2840, -2161}, {2983, -2539}, {5631, -1339},
+        {4141, -1292}, {4419, -1717}, {3798, -86}, {4062, -2351}, {3407, -1718}, {4735, 768},
+        {3174, -1638}, {4554, 1283}, {2262, 2188}, {3847, -124}, {2531, 1048}, {890, 2110},
+        {2586, 2074}, {2986, 4711}, {3898, 4949}, {1169, 4117}, {3063, 1961}, {-66, 4326},
+        {1281, 5905}, {1307, 3367}, {-800, 2364}, {471, 2860}, {-1064, 2233}, {-1450, 2987},
+        {-242, 4620}, {-1899, 3399}, {-632, 5312}, {-4748, 3042}, {-2383, 3600}, {-4100, 2346},
+        {-2137, 2552}, {-2620, 2557}, {-2133, 3019}, {-3125, 4707}, {-3821, 2723}, {-2387, 263},
+        {-3462, 789}, {-3022, 184}, {-3851, 565}, {-6274, -522}, {-4530, -1795}, {-4799, -1176},
+        {-5865, -1153}, {-3422, -3217}, {-5726, -896}, {-3515, -1313}, {-3752, -2045}, {-2875, -2043},
+        {-1896, -3776}, {-2833, -4815}, {-1222, -1546}, {-1397, -2805}, {-1429, -2081}, {-123, -2585},
+        {901, -3457}, {1720, -6588}, {-587, -4799}, {2777, -3970}, {-962, -2015}, {2649, -2618},
+        {3632, -4995}, {2014, -4594}, {3890, -3090}, {1393, -3133}, {4095, -2347}, {3026, -2451},
+        {4023, -4254}, {4492, 1096}, {4633, -2774}, {5778, 435}, {5648, -1741}, {2765, -1261},
+        {3774, 1629}, {2519, 305}, {4174, -12}, {4383, 499}, {3235, 2543}, {4135, 1586},
+        {3412, 2136}, {3184, 4360}, {3685, 4655}, {1720, 3549}, {3213, 2230}, {3229, 4395},
+        {2008, 5198}, {-524, 1783}, {888, 3558}, {-906, 5796}, {381, 6685}, {-295, 2471},
+        {-2245, 2602}, {-1312, 2806}, {-1909, 4563}, {-1499, 2159}, {-2070, 3382}, {-4592, 1533},
+        {-1998, 2286}, {-4855, 1498}, {-3623, 1983}, {-3285, 2058}, {-1540, 2965}, {-3616, 550},
+        {-2691, -890}, {-3944, 770}, {-3141, -723}, {-2870, 2968}, {-4861, -605}, {-4494, -554},
+        {-6319, -1437}, {-2704, -2292}, {-2452, -1533}, {-5502, -2053}, {-2636, -3706}, {-4946, -2853},
+        {-2192, -4203}, {-1353, -4982}, {-2929, -5078}, {820, -4856}, {-3045, -7572}, {-636, -2372},
+        {-1463, -3540}, {57, -4178}, {1097, -3925}, {1208, -2679}, {-1120, -2447}, {979, -5225},
+        {1001, -4272}, {2176, -3406}, {1525, -2033}, {2438, -3152}, {1559, -3390}, {3014, -652},
+        {4085, -124}, {4686, -2113}, {4052, -1556}, {3625, -2499}, {3922, -1901}, {2797, -1412},
+        {4801, -864}, {3211, -459}, {5002, 2873}, {4946, 1082}, {2817, -1704}, {2026, -381},
+        {3952, 2191}, {5033, 1949}, {1623, 3224}, {3265, 3090}, {2593, 814}, {3846, 3633},
+        {967, 5457}, {-439, 4271}, {-218, 4943}, {80, 5128}, {-1100, 7051}, {-824, 1646},
+        {-1416, 3657}, {-301, 5377}, {-851, 4629}, {-1964, 3823}, {-2509, 4172}, {-3657, 2846},
+        {-2703, 2564}, {402, 4428}, {-2780, 4068}, {-5542, 1388}, {-5533, -312}, {-3536, -496},
+        {-3839, 1802}, {-4388, 2490}, {-4754, 88}, {-4183, 482}, {-4021, 735}, {-2349, -643},
+        {-1143, -862}, {-5488, -1580}, {-3878, -4964}, {-3599, -2349}, {-5013, -983}, {-3489, -3619},
+        {-3326, -1303}, {-1198, -4718}, {-1171, -2023}, {-1197, -4154}, {-1357, -4457}, {-3509, -3275},
+        {-345, -4110}, {-376, -4531}, {1878, -2936}, {209, -3546}, {2170, -2955}, {105, -4248},
+        {1189, -6159}, {5485, -4247}, {430, -4889}, {1819, -2576}, {3899, -1966}, {2562, -1759},
+        {3461, -3081}, {4579, -3030}, {5508, -1556}, {3342, -3016}, {4764, -963}, {2944, -1048},
+        {1656, 1067}, {5364, 152}, {3735, -2409}, {4249, 988}, {4084, 1988}, {6344, 1610},
+        {2523, 2741}, {3327, 3066}, {2368, 3257}, {2480, 2211}, {4492, 1425}, {2489, 4611},
+        {2775, 4206}, {-119, 3722}, {542, 5343}, {383, 1615}, {14, 4547}, {2636, 3627},
+        {-354, 2523}, {-612, 4484}, {-46, 4440}, {-2630, 3282}, {-4029, 5485}, {-3227, 4068},
+        {-4461, 2482}, {-2234, 3036}, {-3350, 3916}, {-4749, 2931}, {-1729, 2849}, {-1643, 3023},
+        {-2897, 1426}, {-4977, 811}, {-4957, 2731}, {-5414, 1425}, {-4646, 1762}, {-2822, -2646},
+        {-1762, -578}, {-3400, -2290}, {-4658, 516}, {-4052, -3773}, {-3125, -3965}, {-2853, -4248},
+        {-1634, 123}, {-2686, -2973}, {-3771, -3230}, {-1384, -2716}, {-3314, -4219}, {-538, -3546},
+        {-15, -2841}, {602, -3340}, {-651, -3315}, {530, -2499}, {-1470, -2698}, {638, -4217},
+        {1046, -391}, {1345, -2575}, {2419, -2881}, {2476, -2717}, {2238, -3906}, {3981, -2964},
+        {3552, -2236}, {2717, -3045}, {4721, -1199}, {3988, -3225}, {2877, -232}, {3482, 1006},
+        {7343, -1115}, {3703, -812}, {4437, 1548}, {3591, 208}, {5252, 197}, {3485, 1184},
+        {4500, 2569}, {3567, 2914}, {4087, 4057}, {2715, 2075}, {1419, 4763}, {2262, 1999},
+        {907, 1980}, {3977, 2007}, {2357, 2641}, {635, 2045}, {1294, 5244}, {903, 4816},
+        {1211, 4696}, {2052, 5240}, {817, 3205}, {586, 1266}, {-3272, 5039}, {-1396, 1913},
+        {-2183, 3143}, {-1509, 2629}, {-1336, 4436}, {-3667, 1008}, {-2592, 1180}, {-2412, 2104},
+        {-4596, -442}, {-4438, 954}, {-5148, 1641}, {-2962, -271}, {-3655, 1573}, {-3791, -979},
+        {-3574, -2352}, {-4597, -1071}, {-2499, -2279}, {-3074, -2808}, {-3424, -1790}, {-3314, -4223},
+        {-2028, -553}, {-2576, -4222}, {-3712, -4200}, {-3291, -4910}, {-1281, -4581}, {-768, -5251},
+        {-165, -2843}, {-2392, -4390}, {-360, -4385}, {-350, -4664}, {215, -3421}, {679, -4857},
+        {1768, -3891}, {395, -2813}, {1594, -3835}, {4118, -2674}, {1128, -3039}, {2387, -3434},
+        {3616, -2565}, {2554, -1527}, {3143, -2862}, {4027, -2039}, {3604, -1203}, {3930, -2453},
+        {2476, -861}, {4580, -894},
+};
+
+#endif //OPENHOOP_GRAVITYTRACE_H
@@ -0,0 +1,112 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests of the FluidSimulation class, replaying an accelerometer trace.
+ * @details Feeds the gravity trace to the simulation the way FluidEffect does, with the same substeps and the same
+ * TapDetector, and checks after every step that the volume of liquid is unchanged and that every depth stayed within
+ * the flow a step allows, which a depth wrapping around below zero or past 65535 would break.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include "utils/FluidSimulation.h"
+#include "GravityTrace.h"
+
+namespace {
+
+constexpr uint16_t TRACE_LENGTH = sizeof(GRAVITY_TRACE) / sizeof(GRAVITY_TRACE[0]);  ///< Number of readings.
+constexpr uint8_t SUBSTEPS = 4;  ///< Steps per reading, as FluidEffect::SUBSTEPS.
+
+FluidSimulation fluid;
+
+/**
+ * @brief Replay readings of the trace, checking the volume and depths after every step.
+ * @details Clamping the velocities lets no more than 3/8 of the depth of a cell flow across each of its boundaries in a
+ * step, so a cell keeps at least a quarter of its depth and gains at most 3/8 of the depth of each neighbour. A depth
+ * that went below zero or past 65535 would wrap around far outside these bounds.
+ * @param readings Number of readings to replay from the start of the trace.
+ * @return Number of taps detected.
+ */
+uint16_t replay(uint16_t readings) {
+    const uint32_t volume = fluid.getVolume();
+    const uint16_t size = fluid.getSize();
+    TapDetector taps;
+    uint16_t tapCount = 0;
+    uint32_t before[NUM_LEDS];
+    for (uint16_t r = 0; r < readings; r++) {
+        const int32_t x = GRAVITY_TRACE[r][0];
+        const int32_t y = GRAVITY_TRACE[r][1];
+        tapCount += taps.addReading(x, y, fluid) ? 1 : 0;
+        for (uint8_t s = 0; s < SUBSTEPS; s++) {
+            for (uint16_t i = 0; i < size; i++) {
+                before[i] = fluid.getDepth(i);
+            }
+            fluid.step(x, y);
+
+            uint32_t sum = 0;
+            for (uint16_t i = 0; i < size; i++) {
+                const uint32_t neighbours = before[i > 0 ? i - 1 : size - 1] + before[i + 1 < size ? i + 1 : 0];
+                TEST_ASSERT_GREATER_OR_EQUAL_UINT32(before[i], 4 * fluid.getDepth(i));
+                TEST_ASSERT_LESS_OR_EQUAL_UINT32(8 * before[i] + 3 * neighbours, 8 * fluid.getDepth(i));
+                sum += fluid.getDepth(i);
+            }
+            TEST_ASSERT_EQUAL_UINT32(volume, sum);
+            TEST_ASSERT_EQUAL_UINT32(volume, fluid.getVolume());
+        }
+    }
+    return tapCount;
+}
+
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_volume_and_depths_hold_over_trace() {
+    const uint16_t sizes[] = {NUM_LEDS, NUM_LEDS / 2, NUM_LEDS / 3, 7};
+    for (uint16_t size : sizes) {
+        fluid.reset(size, 96);
+        // The taps and the shaking of the spin splash the liquid along the way
+        TEST_ASSERT_GREATER_THAN(0, replay(TRACE_LENGTH));
+    }
+}
+
+void test_volume_and_depths_hold_with_deep_liquid() {
+    fluid.reset(NUM_LEDS, 2048);
+    replay(TRACE_LENGTH);
+}
+
+void test_liquid_pools_at_the_bottom() {
+    // The trace starts held still with gravity along X, so the lowest cell is cell 0
+    fluid.reset(NUM_LEDS, 96);
+    replay(300);
+    TEST_ASSERT_GREATER_THAN(fluid.getDepth(NUM_LEDS / 2) + 96, fluid.getDepth(0));
+    TEST_ASSERT_LESS_THAN(96, fluid.getDepth(NUM_LEDS / 2));
+}
+
+void test_replay_is_deterministic() {
+    fluid.reset(NUM_LEDS, 96);
+    replay(TRACE_LENGTH);
+    uint16_t first[NUM_LEDS];
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        first[i] = fluid.getDepth(i);
+    }
+
+    fluid.reset(NUM_LEDS, 96);
+    replay(TRACE_LENGTH);
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        TEST_ASSERT_EQUAL_UINT16(first[i], fluid.getDepth(i));
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_volume_and_depths_hold_over_trace);
+    RUN_TEST(test_volume_and_depths_hold_with_deep_liquid);
+    RUN_TEST(test_liquid_pools_at_the_bottom);
+    RUN_TEST(test_replay_is_deterministic);
+    return UNITY_END();
+}
@@ -0,0 +1,190 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests and benchmark of the packed and run-length encoded image formats.
+ * @details Encodes the pixel tables of every image shipped with the firmware in both formats, checks that both decode
+ * to the colors of the shipped image class, and prints the column decoding time per pixel of each format. These are the host
+ * measurements behind the comparison of the formats; IMAGE_PROFILING in Config.h times the shipped format on the hoop.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "images/CupcakeImage.h"
+#include "images/CupcakePixels.h"
+#include "images/FlowerImage.h"
+#include "images/FlowerPixels.h"
+#include "images/LeopardPrintImage.h"
+#include "images/LeopardPrintPixels.h"
+#include "images/MushroomImage.h"
+#include "images/MushroomPixels.h"
+#include "images/RleImage.h"
+
+namespace {
+
+constexpr int PASSES = 2000;  ///< Number of times every column is decoded per round.
+constexpr int ROUNDS = 15;    ///< Number of rounds timed per measurement, keeping the fastest.
+
+/**
+ * @brief Pixel table of a single image wrapped as a one-frame animation, as encodeRuns takes.
+ */
+template<int W, int H>
+struct SingleFrame {
+    uint8_t pixels[1][H][W];  ///< Palette indices of the only frame.
+};
+
+/**
+ * @brief Wrap the pixel table of a single image as a one-frame animation.
+ */
+template<int W, int H>
+constexpr SingleFrame<W, H> singleFrame(const uint8_t (&pixels)[H][W]) {
+    SingleFrame<W, H> frame{};
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            frame.pixels[0][y][x] = pixels[y][x];
+        }
+    }
+    return frame;
+}
+
+constexpr auto CUPCAKE_PACKED = packPixels<CupcakePixels::BITS>(CupcakePixels::PIXELS[0]);
+constexpr auto CUPCAKE_RLE = encodeRuns<countRuns(CupcakePixels::PIXELS)>(CupcakePixels::PIXELS);
+
+constexpr auto FLOWER_FRAME = singleFrame(FlowerPixels::PIXELS);
+constexpr auto FLOWER_PACKED = packPixels<FlowerPixels::BITS>(FlowerPixels::PIXELS);
+constexpr auto FLOWER_RLE = encodeRuns<countRuns(FLOWER_FRAME.pixels)>(FLOWER_FRAME.pixels);
+
+constexpr auto LEOPARD_FRAME = singleFrame(LeopardPrintPixels::PIXELS);
+constexpr auto LEOPARD_PACKED = packPixels<LeopardPrintPixels::BITS>(LeopardPrintPixels::PIXELS);
+constexpr auto LEOPARD_RLE = encodeRuns<countRuns(LEOPARD_FRAME.pixels)>(LEOPARD_FRAME.pixels);
+
+constexpr auto MUSHROOM_FRAME = singleFrame(MushroomPixels::PIXELS);
+constexpr auto MUSHROOM_PACKED = packPixels<MushroomPixels::BITS>(MushroomPixels::PIXELS);
+constexpr auto MUSHROOM_RLE = encodeRuns<countRuns(MUSHROOM_FRAME.pixels)>(MUSHROOM_FRAME.pixels);
+
+/**
+ * @brief Shipped image whose palette can be read, to give both formats the same colors.
+ */
+template<typename Image>
+class Shipped : public Image {
+public:
+    using Image::Image;
+    using LedImage::paletteColor;
+};
+
+/**
+ * @brief Run-length encoded image built from the tables above.
+ */
+class RunImage : public RleImage {
+public:
+    RunImage(int w, int h, const uint16_t* offsets, const uint8_t* runs) : RleImage(w, h, 1, offsets, runs, {}) {}
+};
+
+/**
+ * @brief Assert that two images decode every column to the same colors.
+ */
+void assertSameColumns(LedImage& expected, LedImage& actual) {
+    TEST_ASSERT_EQUAL_INT(expected.width, actual.width);
+    TEST_ASSERT_EQUAL_INT(expected.height, actual.height);
+    for (int x = 0; x < expected.width; x++) {
+        const LedColumn first = expected.column(x);
+        const LedColumn second = actual.column(x);
+        TEST_ASSERT_EQUAL_INT(first.height, second.height);
+        for (int y = 0; y < first.height; y++) {
+            TEST_ASSERT_EQUAL_UINT8(first.pixels[y].red, second.pixels[y].red);
+            TEST_ASSERT_EQUAL_UINT8(first.pixels[y].green, second.pixels[y].green);
+            TEST_ASSERT_EQUAL_UINT8(first.pixels[y].blue, second.pixels[y].blue);
+            TEST_ASSERT_EQUAL_UINT8(first.pixels[y].alpha, second.pixels[y].alpha);
+        }
+    }
+}
+
+/**
+ * @brief Time the column decoding of an image, as ImageProfiler does on the hoop.
+ * @details Keeps the fastest of several rounds, which other processes on the computer can only slow down.
+ * @return Decoding time per pixel, in nanoseconds.
+ */
+double nanosPerPixel(LedImage& image) {
+    volatile uint32_t checksum = 0;
+    double fastest = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < PASSES; pass++) {
+            for (int x = 0; x < image.width; x++) {
+                const LedColumn column = image.column(x);
+                checksum = checksum + column.pixels[column.height - 1].red;
+            }
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        fastest = round == 0 || elapsed.count() < fastest ? elapsed.count() : fastest;
+    }
+    return fastest / (static_cast<double>(PASSES) * image.width * image.height);
+}
+
+/**
+ * @brief Check both formats of an image against the shipped one, then print their decoding times and sizes.
+ * @details Both formats start without colors and take the palette of the shipped image.
+ */
+template<typename Image>
+void compareFormats(const char* name, Shipped<Image>& shipped, LedImage& packed, size_t packedBytes, LedImage& runs,
+                    size_t runBytes) {
+    for (uint8_t index = 0; index < LedImage::MAX_COLORS; index++) {
+        packed.setPaletteColor(index, shipped.paletteColor(index));
+        runs.setPaletteColor(index, shipped.paletteColor(index));
+    }
+    assertSameColumns(shipped, packed);
+    assertSameColumns(shipped, runs);
+
+    char message[128];
+    snprintf(message, sizeof(message), "%s Decode Time (ns/pixel): packed %.2f (%u B), RLE %.2f (%u B)", name,
+             nanosPerPixel(packed), static_cast<unsigned>(packedBytes), nanosPerPixel(runs),
+             static_cast<unsigned>(runBytes));
+    TEST_MESSAGE(message);
+}
+
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_cupcake_formats() {
+    Shipped<CupcakeImage> shipped(LedColor(255, 0, 255));
+    LedImage packed(CupcakePixels::WIDTH, CupcakePixels::HEIGHT, CupcakePixels::BITS, CUPCAKE_PACKED.data, {});
+    RunImage runs(CupcakePixels::WIDTH, CupcakePixels::HEIGHT, CUPCAKE_RLE.offsets, CUPCAKE_RLE.runs);
+    compareFormats("Cupcake", shipped, packed, sizeof(CUPCAKE_PACKED), runs, sizeof(CUPCAKE_RLE));
+}
+
+void test_flower_formats() {
+    Shipped<FlowerImage> shipped(LedColor(255, 0, 255));
+    LedImage packed(FlowerPixels::WIDTH, FlowerPixels::HEIGHT, FlowerPixels::BITS, FLOWER_PACKED.data, {});
+    RunImage runs(FlowerPixels::WIDTH, FlowerPixels::HEIGHT, FLOWER_RLE.offsets, FLOWER_RLE.runs);
+    compareFormats("Flower", shipped, packed, sizeof(FLOWER_PACKED), runs, sizeof(FLOWER_RLE));
+}
+
+void test_leopard_print_formats() {
+    Shipped<LeopardPrintImage> shipped(LedColor(0, 0, 100), LedColor(0, 100, 0));
+    LedImage packed(LeopardPrintPixels::WIDTH, LeopardPrintPixels::HEIGHT, LeopardPrintPixels::BITS,
+                    LEOPARD_PACKED.data, {});
+    RunImage runs(LeopardPrintPixels::WIDTH, LeopardPrintPixels::HEIGHT, LEOPARD_RLE.offsets, LEOPARD_RLE.runs);
+    compareFormats("Leopard Print", shipped, packed, sizeof(LEOPARD_PACKED), runs, sizeof(LEOPARD_RLE));
+}
+
+void test_mushroom_formats() {
+    Shipped<MushroomImage> shipped(LedColor(255, 0, 0));
+    LedImage packed(MushroomPixels::WIDTH, MushroomPixels::HEIGHT, MushroomPixels::BITS, MUSHROOM_PACKED.data, {});
+    RunImage runs(MushroomPixels::WIDTH, MushroomPixels::HEIGHT, MUSHROOM_RLE.offsets, MUSHROOM_RLE.runs);
+    compareFormats("Mushroom", shipped, packed, sizeof(MUSHROOM_PACKED), runs, sizeof(MUSHROOM_RLE));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_cupcake_formats);
+    RUN_TEST(test_flower_formats);
+    RUN_TEST(test_leopard_print_formats);
+    RUN_TEST(test_mushroom_formats);
+    return UNITY_END();
+}
@@ -0,0 +1,178 @@
+/**
+ * @project OpenHoop
+ * @file GyroTrace.h
+ * @brief Gyroscope trace replayed by the persistence-of-vision scheduling tests.
+ * @details Rotation rate of the hoop as EffectUtils::getRotationRate returns it, 65536 per turn per second, sampled at
+ * 100 Hz for 15 seconds. The trace was generated from a model of the motion rather than captured on a hoop: 1 s held
+ * still, 2 s spun up to 2 turns per second, 5 s wobbling 8% around that speed at 1.2 Hz, 1 s pushed up to 4 turns per
+ * second and held for 2 s, then 2 s slowed down and reversed to 1.5 turns per second the other way, held for 2 s. The
+ * sensor noise is 150 units while spinning and 60 units at rest.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_GYROTRACE_H
+#define OPENHOOP_GYROTRACE_H
+
+#include <stdint.h>
+
+constexpr uint32_t GYRO_TRACE_PERIOD = 10000;  ///< Time between two readings, in microseconds.
+
+/**
+ * @brief Rotation rate readings.
+ */
+const int32_t GYRO_TRACE[] = {
+        -30, -10, -12, -49, 36, -15, 3, -36, 119, -26,
+        68, 54, 14, 70, 21, -28, 5, 23, 65, 27,
+        16, 27, -16, -47, -29, 46, 26, -40, -84, -113,
+        -44, -21, 56, 67, 27, 54, 42, -96, -10, 56,
+        -12, 48, -30, 1, 25, 22, -36, 65, -27, 58,
+        16, -103, -111, 59, 79, 0, -25, -56, -42, 20,
+        4, -39, -87, -37, 65, -121, 18, 30, -19, 111,
+        -85, -47, -67, 29, 59, -8, -79, 38, 85, -98,
+        -17, -3, 12, 8, 86, 2, -18, 19, 29, -76,
+        -115, -7, 54, 37, -59, -35, 22, 102, 122, -153,
+        -32, 595, 1312, 2004, 2779, 3262, 3928, 4617, 5084, 6270,
+        6522, 7154, 7907, 8872, 9068, 10064, 10453, 11095, 11997, 12246,
+        13171, 13732, 14428, 15205, 15811, 16209, 17294, 17642, 18530, 19094,
+        19899, 20461, 21092, 21635, 22072, 22748, 23794, 24443, 25024, 25642,
+        26238, 26706, 27451, 28029, 28694, 29267, 30050, 30814, 31622, 32128,
+        32792, 33550, 34109, 34825, 35524, 36029, 36736, 37334, 37704, 38599,
+        39244, 39907, 40539, 41123, 41754, 42568, 43147, 43667, 44946, 45337,
+        45769, 46432, 47271, 47907, 48734, 49255, 49820, 50530, 50892, 51850,
+        52570, 53332, 53959, 54348, 55276, 55824, 56467, 56901, 57771, 58231,
+        59240, 59765, 60279, 61261, 61568, 62108, 62759, 63467, 64088, 65111,
+        65587, 66103, 66655, 67332, 67889, 68811, 69702, 70036, 70946, 71767,
+        72190, 72664, 73424, 74001, 74754, 75178, 76142, 76574, 77260, 77725,
+        78681, 79190, 80088, 80683, 81118, 82345, 82841, 83341, 83833, 84275,
+        85321, 86105, 86746, 86987, 87725, 88276, 89203, 89484, 90472, 91048,
+        91926, 92475, 93302, 93720, 94438, 94887, 95573, 96332, 96938, 97794,
+        98245, 99209, 99549, 100427, 100739, 101660, 102216, 102886, 103708, 104105,
+        104560, 105294, 105995, 106667, 107463, 107991, 108629, 109404, 110197, 110554,
+        111461, 112023, 112644, 113394, 114066, 114587, 115464, 116018, 116421, 117449,
+        117773, 118482, 119374, 119826, 120665, 121287, 121900, 122483, 122975, 123710,
+        124603, 125242, 126075, 126424, 127084, 127805, 128497, 128934, 129922, 130331,
+        131340, 132056, 132758, 133317, 133890, 134685, 135808, 136548, 137168, 137870,
+        138267, 138800, 139082, 139866, 139964, 140231, 140945, 141121, 141214, 141329,
+        141715, 141656, 141213, 141474, 141266, 141164, 141112, 140289, 139638, 139516,
+        139263, 138742, 138360, 137495, 137031, 136334, 135578, 134467, 133816, 133053,
+        132284, 131588, 130897, 130016, 129444, 128340, 128059, 126944, 125985, 125692,
+        125125, 124166, 123893, 123222, 122851, 122061, 121857, 121644, 121194, 120981,
+        120701, 120690, 120642, 120440, 120659, 120629, 120879, 120949, 121267, 121440,
+        122361, 122630, 123107, 123502, 123968, 124785, 126000, 126534, 126795, 127605,
+        128678, 129202, 129985, 130740, 131523, 132597, 133243, 133852, 134639, 135549,
+        135887, 136750, 137562, 137913, 138508, 139242, 139582, 139841, 140560, 140752,
+        141305, 141159, 141663, 141508, 141749, 141450, 141481, 141170, 141044, 140748,
+        140645, 139994, 139774, 139151, 138664, 138279, 137882, 136749, 136543, 135622,
+        134950, 134325, 133346, 132813, 131755, 131160, 130346, 129283, 128761, 127832,
+        127233, 126755, 125759, 125226, 124551, 123834, 123413, 122597, 122405, 121972,
+        121530, 121175, 121158, 120974, 120621, 120626, 120462, 121004, 120745, 121120,
+        120993, 121251, 121718, 121884, 122245, 123211, 123246, 124144, 124809, 125338,
+        126283, 126717, 127600, 127966, 128709, 129738, 130700, 131332, 132009, 132948,
+        133844, 134489, 135200, 135739, 136406, 137244, 137953, 138587, 138844, 139369,
+        139958, 140557, 140883, 141095, 141280, 141098, 141537, 141646, 141472, 141194,
+        141434, 141145, 140801, 140765, 140271, 140087, 139437, 139171, 138662, 137804,
+        137252, 136488, 135845, 135243, 134486, 133598, 132921, 132320, 131206, 130358,
+        129677, 128984, 128446, 127268, 126458, 125929, 125198, 124601, 124190, 123661,
+        122884, 122559, 122042, 121679, 121537, 120902, 120766, 120766, 120769, 120518,
+        120667, 120622, 120871, 120935, 121167, 121534, 121949, 122421, 123074, 123438,
+        124087, 124554, 125223, 125784, 126386, 127401, 127795, 128941, 129562, 129947,
+        131198, 131752, 132375, 133646, 134326, 135034, 135608, 136509, 136948, 137819,
+        138159, 138603, 139149, 139773, 140101, 140810, 140744, 141366, 141488, 141510,
+        141561, 141239, 141344, 141382, 141205, 141193, 140815, 140505, 140133, 139969,
+        139200, 138812, 137839, 137291, 136836, 136022, 135463, 134714, 133953, 133347,
+        132098, 131895, 130861, 130234, 129218, 128663, 127738, 127141, 126440, 125463,
+        125129, 124356, 123832, 123039, 122480, 122619, 121557, 121638, 121451, 120941,
+        120813, 120921, 120756, 120641, 120658, 120962, 120781, 121074, 121361, 121667,
+        122347, 122463, 123311, 123782, 124347, 124636, 125626, 126274, 126945, 127763,
+        128527, 129116, 129922, 130826, 131567, 132339, 132812, 134015, 134731, 135650,
+        136058, 136867, 137509, 138101, 138757, 139245, 139735, 140175, 140477, 140606,
+        141165, 141085, 141282, 141601, 141569, 141588, 141512, 141584, 141190, 140872,
+        140295, 139953, 139864, 139340, 138665, 138216, 137673, 137219, 136327, 135626,
+        134989, 134160, 133449, 132789, 131620, 131261, 130411, 129397, 128756, 127639,
+        127372, 126382, 125812, 125032, 124790, 123999, 123158, 122905, 122391, 121765,
+        121563, 121320, 120885, 120854, 120645, 120795, 120402, 120580, 120752, 120779,
+        120979, 121476, 121804, 122191, 122270, 122898, 123355, 123979, 124680, 125572,
+        126058, 126750, 127324, 128021, 128655, 129638, 130635, 131291, 132168, 132743,
+        133515, 134625, 135158, 135847, 136887, 137173, 137802, 138478, 139066, 139465,
+        139788, 140256, 140558, 141119, 141291, 141163, 141539, 141628, 141420, 141335,
+        141315, 140867, 140856, 140572, 140304, 140017, 139505, 138965, 138578, 138073,
+        137049, 136515, 136096, 135424, 134615, 133729, 132996, 132239, 131392, 130826,
+        130040, 129018, 128249, 127399, 126667, 125946, 125304, 124369, 123985, 123452,
+        122874, 122423, 122207, 121659, 121512, 120999, 121012, 120728, 120492, 120547,
+        120991, 120378, 120668, 120885, 121177, 121691, 122147, 122331, 122666, 123323,
+        123957, 124416, 125074, 125880, 126199, 127040, 127971, 128835, 129496, 130327,
+        131048, 132342, 133903, 134774, 136380, 137654, 138800, 140455, 141566, 143139,
+        144006, 145421, 146787, 148230, 149503, 150649, 152342, 153391, 154688, 155989,
+        157241, 158643, 159852, 161400, 162437, 163627, 165027, 166668, 167818, 168947,
+        170177, 171777, 172814, 174577, 175869, 176991, 178341, 179541, 180835, 182033,
+        183546, 184749, 186215, 187344, 188545, 190148, 191199, 192904, 193882, 195290,
+        196443, 197922, 199142, 200561, 202007, 203254, 204603, 205479, 207083, 208446,
+        209499, 211192, 212487, 213839, 215068, 216356, 217385, 218765, 220106, 221658,
+        222699, 224133, 225724, 226643, 228124, 229358, 230831, 231984, 233388, 234294,
+        236011, 237474, 238710, 240111, 241062, 242462, 243760, 244913, 246177, 247835,
+        249051, 250467, 251732, 253109, 254284, 255667, 256844, 258398, 259775, 261146,
+        262227, 261910, 262036, 262058, 261948, 262158, 262007, 262039, 261993, 262025,
+        262337, 261942, 262065, 262571, 261972, 262156, 262160, 262113, 262269, 262210,
+        262122, 262027, 262069, 262082, 262133, 262042, 262228, 262161, 262352, 261922,
+        262219, 262086, 262253, 262105, 262097, 262124, 262214, 262068, 262342, 262112,
+        262176, 262354, 262234, 262175, 261950, 262163, 261983, 262410, 261913, 262191,
+        262086, 262028, 262036, 261876, 261934, 262252, 262555, 262012, 262193, 262195,
+        262361, 262379, 262110, 262121, 262262, 262066, 261999, 262125, 262391, 262094,
+        262271, 262440, 262003, 262032, 262011, 261997, 261985, 262138, 262217, 262172,
+        262210, 262237, 262054, 262248, 262290, 262075, 262131, 262131, 262332, 262127,
+        262065, 262259, 262006, 262117, 261987, 262071, 262078, 262037, 262009, 262108,
+        262059, 262231, 262070, 262146, 261715, 262384, 262204, 262091, 262316, 261842,
+        262138, 262139, 262092, 262167, 262028, 261965, 262243, 262072, 261906, 261996,
+        262210, 262038, 262225, 262250, 261976, 261876, 262125, 262032, 262210, 262269,
+        262215, 262165, 262052, 262181, 262265, 262083, 262251, 262312, 262384, 262112,
+        262365, 262309, 262213, 262264, 262123, 261949, 262251, 262207, 262129, 262580,
+        262287, 262352, 262044, 262181, 262129, 262175, 262259, 262051, 262095, 262086,
+        261941, 262257, 262091, 262055, 262136, 262164, 262201, 262251, 262116, 262159,
+        261934, 262210, 261871, 261899, 262107, 262157, 261894, 261990, 261943, 262075,
+        262323, 262183, 262239, 261855, 262014, 262040, 262051, 262386, 262294, 261970,
+        262259, 262311, 261890, 262176, 261991, 262498, 262061, 261868, 262142, 262424,
+        262116, 260283, 258837, 256351, 254830, 253154, 251354, 249419, 247690, 245930,
+        243981, 242387, 240402, 238507, 236693, 235136, 233595, 231812, 229557, 228014,
+        226152, 224274, 222689, 220678, 218763, 216993, 215246, 213645, 211468, 209787,
+        207692, 206681, 204256, 202762, 200731, 199328, 197225, 195483, 193954, 191776,
+        189909, 188124, 186479, 184427, 182817, 181113, 179172, 177955, 175278, 173948,
+        172132, 170389, 168433, 166660, 164739, 162895, 161264, 159404, 157462, 155413,
+        154127, 152412, 150550, 148652, 146633, 145097, 143328, 141358, 139542, 137595,
+        136062, 134266, 132431, 130493, 128873, 126855, 125297, 123183, 121716, 119636,
+        117962, 116002, 114115, 112563, 110617, 108850, 107210, 105120, 103483, 101663,
+        99571, 97870, 96393, 94242, 92611, 90631, 89106, 87219, 85376, 83839,
+        82012, 80066, 78165, 76561, 74530, 72754, 71257, 69252, 67460, 65543,
+        63833, 61976, 60284, 58378, 56642, 54747, 52805, 51359, 49535, 47500,
+        45988, 44154, 42487, 40475, 39012, 36953, 35027, 33463, 30940, 29319,
+        27798, 25964, 24146, 22834, 20815, 18736, 16952, 15246, 13606, 11850,
+        9583, 8117, 6312, 4575, 2701, 961, -849, -3057, -4619, -6256,
+        -8281, -9901, -11924, -13391, -15333, -17238, -18971, -20772, -22799, -24362,
+        -26160, -28136, -29714, -31706, -33751, -35263, -36999, -38772, -40431, -42278,
+        -44249, -45810, -47575, -49661, -51356, -53379, -55222, -56940, -58787, -60500,
+        -62194, -64258, -65861, -67750, -69362, -71260, -73164, -74998, -76799, -78575,
+        -80437, -82282, -83847, -85838, -87545, -89362, -91258, -92759, -94685, -96775,
+        -98367, -98122, -98329, -98201, -98448, -98573, -98142, -98431, -98338, -98158,
+        -98351, -98284, -98123, -98263, -98185, -98581, -98077, -98359, -98419, -97987,
+        -98375, -98382, -98280, -98150, -98283, -98274, -98222, -98395, -98291, -97947,
+        -98309, -98238, -98258, -98692, -98417, -98279, -98380, -98065, -98218, -98460,
+        -98373, -98346, -98073, -98453, -98292, -98328, -98333, -98268, -98420, -98065,
+        -97919, -98572, -98238, -98033, -98426, -98189, -98300, -98161, -98465, -98130,
+        -98560, -98360, -98584, -98397, -98105, -98322, -98398, -98250, -98437, -98365,
+        -98184, -98179, -98234, -98343, -98537, -98302, -98526, -98115, -98369, -98595,
+        -97954, -98172, -98200, -98241, -98377, -98451, -98326, -98311, -98210, -98394,
+        -98292, -98024, -98350, -98392, -98300, -98429, -98245, -98313, -98231, -98638,
+        -98423, -98613, -98291, -98296, -98152, -98544, -98064, -98450, -98550, -98494,
+        -98304, -98501, -98352, -98527, -98247, -98216, -98052, -98259, -98261, -98167,
+        -98386, -98431, -98474, -98173, -98356, -98165, -98179, -98282, -98338, -98476,
+        -98282, -98415, -98345, -98046, -98636, -98343, -98445, -98102, -98204, -98051,
+        -98400, -98425, -98224, -98366, -98215, -98097, -98353, -98195, -98097, -98146,
+        -98414, -98186, -98246, -98630, -98156, -98217, -98415, -98270, -98190, -98141,
+        -98259, -98233, -98319, -98213, -98490, -98319, -98314, -98413, -98256, -98273,
+        -98345, -98217, -98079, -98424, -98322, -98385, -98368, -98290, -98566, -98415,
+        -98315, -98302, -98485, -98299, -98170, -98427, -98262, -98175, -98584, -98355,
+        -98527, -98115, -98484, -97974, -98361, -98159, -98297, -98520, -98258, -98401,
+};
+
+#endif //OPENHOOP_GYROTRACE_H
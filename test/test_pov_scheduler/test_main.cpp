@@ -0,0 +1,120 @@
+/**
+ * @project OpenHoop
+ * @file test_main.cpp
+ * @brief Host tests of the RotationTracker and PovScheduler classes, replaying a gyroscope trace.
+ * @details Feeds the gyroscope trace to the tracker and polls the scheduler between the readings the way PovEffect
+ * does. The rotation the trace describes is integrated separately, its rate varying linearly between readings, and
+ * every column switched to is checked against the angle the hoop actually reached.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <unity.h>
+#include <math.h>
+#include "utils/PovScheduler.h"
+#include "utils/RotationTracker.h"
+#include "GyroTrace.h"
+
+namespace {
+
+constexpr uint16_t TRACE_LENGTH = sizeof(GYRO_TRACE) / sizeof(GYRO_TRACE[0]);  ///< Number of readings.
+
+/**
+ * @brief Outcome of a replay of the trace.
+ */
+struct Replay {
+    PovStats stats;              ///< Statistics of the scheduler at the end of the trace.
+    uint32_t crossedColumns = 0;  ///< Column edges the hoop turned past, in either direction.
+    uint32_t crossedTurns = 0;    ///< Turn edges the hoop turned past, in either direction.
+    double maxError = 0;          ///< Largest distance between the hoop and the column switched to, in columns.
+};
+
+/**
+ * @brief Replay the trace, polling the scheduler at a fixed period.
+ * @details The tracker and the hoop start in the middle of column 0, so the noise at rest does not cross an edge.
+ * @param columnsPerTurn Number of columns per turn.
+ * @param pollMicros Time between two polls, in microseconds.
+ */
+Replay replay(uint16_t columnsPerTurn, uint32_t pollMicros) {
+    RotationTracker tracker;
+    PovScheduler scheduler;
+    tracker.reset(static_cast<uint32_t>((1ULL << 32) / columnsPerTurn / 2));
+    scheduler.reset(columnsPerTurn);
+
+    Replay result;
+    const double start = 0.5 / columnsPerTurn;
+    double reading = start;  // Angle of the hoop at the last reading, in turns
+    double lastColumn = floor(start * columnsPerTurn);
+    double lastTurn = floor(start);
+    uint16_t next = 0;
+    const uint32_t end = (TRACE_LENGTH - 1) * GYRO_TRACE_PERIOD;
+    for (uint32_t time = 0; time <= end; time += pollMicros) {
+        while (next < TRACE_LENGTH && next * GYRO_TRACE_PERIOD <= time) {
+            if (next > 0) {
+                reading += (GYRO_TRACE[next - 1] + GYRO_TRACE[next]) / 2.0 * GYRO_TRACE_PERIOD / 1e6 / 65536;
+            }
+            tracker.addReading(GYRO_TRACE[next], next * GYRO_TRACE_PERIOD);
+            next++;
+        }
+
+        // Angle of the hoop, its rate varying linearly from the last reading to the next one
+        const double elapsed = (time - (next - 1) * GYRO_TRACE_PERIOD) / 1e6;
+        const int32_t from = GYRO_TRACE[next - 1];
+        const int32_t to = next < TRACE_LENGTH ? GYRO_TRACE[next] : from;
+        const double slope = (to - from) / (GYRO_TRACE_PERIOD / 1e6);
+        const double angle = reading + (from * elapsed + slope * elapsed * elapsed / 2) / 65536;
+
+        const double column = floor(angle * columnsPerTurn);
+        const double turn = floor(angle);
+        result.crossedColumns += static_cast<uint32_t>(fabs(column - lastColumn));
+        result.crossedTurns += static_cast<uint32_t>(fabs(turn - lastTurn));
+        lastColumn = column;
+        lastTurn = turn;
+
+        uint16_t shown;
+        if (scheduler.poll(tracker.getAngle(time), tracker.getRate(), shown)) {
+            // Distance from the hoop to the column shown, wrapped around the turn
+            const double position = (angle - turn) * columnsPerTurn;
+            double error = position < shown ? shown - position : position >= shown + 1 ? position - shown - 1 : 0;
+            error = error < columnsPerTurn - 1 - error ? error : columnsPerTurn - 1 - error;
+            result.maxError = error > result.maxError ? error : result.maxError;
+        }
+    }
+    result.stats = scheduler.getStats();
+    return result;
+}
+
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_columns_follow_the_hoop() {
+    // Polls every 100 us reach each of 64 columns before the hoop leaves it, up to 4 turns per second
+    const Replay result = replay(64, 100);
+    TEST_ASSERT_EQUAL_UINT32(0, result.stats.missedColumns);
+    TEST_ASSERT_EQUAL_UINT32(result.crossedColumns + 1, result.stats.columns);
+    TEST_ASSERT_EQUAL_UINT32(28, result.crossedTurns);
+    TEST_ASSERT_EQUAL_UINT32(result.crossedTurns, result.stats.turns);
+    TEST_ASSERT_TRUE(result.maxError < 0.01);
+    TEST_ASSERT_TRUE(result.stats.timedColumns > 0);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(100, result.stats.totalDelay / result.stats.timedColumns);
+}
+
+void test_slow_polls_count_missed_columns() {
+    // At 4 turns per second the hoop crosses 2 of 512 columns between two polls 1 ms apart
+    const Replay result = replay(512, 1000);
+    TEST_ASSERT_GREATER_THAN(0, result.stats.missedColumns);
+    TEST_ASSERT_EQUAL_UINT32(result.crossedColumns + 1, result.stats.columns + result.stats.missedColumns);
+    TEST_ASSERT_EQUAL_UINT32(result.crossedTurns, result.stats.turns);
+    TEST_ASSERT_TRUE(result.maxError < 0.1);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_columns_follow_the_hoop);
+    RUN_TEST(test_slow_polls_count_missed_columns);
+    return UNITY_END();
+}
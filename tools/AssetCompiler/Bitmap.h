@@ -0,0 +1,37 @@
+/**
+ * @project OpenHoop
+ * @file Bitmap.h
+ * @brief Header file for the Bitmap struct, the decoded frames of an image file read by the asset compiler.
+ * @details Defines the Rgba and Bitmap structs shared by the image readers, the quantizer and the source writer of the
+ * asset compiler, a host tool that is not part of the firmware.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ASSETCOMPILER_BITMAP_H
+#define OPENHOOP_ASSETCOMPILER_BITMAP_H
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @brief Color of a decoded pixel.
+ */
+struct Rgba {
+    uint8_t red = 0;    ///< Red component.
+    uint8_t green = 0;  ///< Green component.
+    uint8_t blue = 0;   ///< Blue component.
+    uint8_t alpha = 0;  ///< Alpha component, 0 for fully transparent.
+};
+
+/**
+ * @brief Frames of a decoded image file, all of the same size.
+ */
+struct Bitmap {
+    int width = 0;   ///< Width of the frames.
+    int height = 0;  ///< Height of the frames.
+    std::vector<std::vector<Rgba>> frames;  ///< Pixels of each frame, row by row.
+};
+
+#endif //OPENHOOP_ASSETCOMPILER_BITMAP_H
@@ -0,0 +1,289 @@
+/**
+ * @project OpenHoop
+ * @file GifReader.cpp
+ * @brief Source file for the GifReader class, a decoder of animated GIF files for the asset compiler.
+ * @details Implements the block parsing, the LZW decompression of the frames, the interlaced row order and the frame
+ * disposal methods, following the GIF89a specification.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "GifReader.h"
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr int MAX_CODES = 4096;  ///< Size of the LZW string table, for codes of up to 12 bits.
+
+enum Disposal : uint8_t {
+    KEEP = 1,               ///< Leave the frame on the canvas.
+    RESTORE_BACKGROUND = 2, ///< Clear the area of the frame.
+    RESTORE_PREVIOUS = 3,   ///< Restore the canvas as it was before the frame.
+};
+
+/**
+ * @brief Sequential reader of the bytes of a file.
+ */
+class ByteReader {
+public:
+    explicit ByteReader(const std::vector<uint8_t>& file) : file(file) {}
+
+    uint8_t byte() {
+        if (position >= file.size()) {
+            throw std::runtime_error("GIF file ends early");
+        }
+        return file[position++];
+    }
+
+    uint16_t uint16() {
+        const uint8_t low = byte();
+        return low | byte() << 8;
+    }
+
+    /**
+     * @brief Read a sequence of data sub-blocks up to its terminator.
+     */
+    std::vector<uint8_t> subBlocks() {
+        std::vector<uint8_t> data;
+        for (uint8_t size = byte(); size != 0; size = byte()) {
+            for (uint8_t i = 0; i < size; i++) {
+                data.push_back(byte());
+            }
+        }
+        return data;
+    }
+
+    /**
+     * @brief Read a color table of a number of entries.
+     */
+    std::vector<Rgba> colorTable(int entries) {
+        std::vector<Rgba> table(entries);
+        for (Rgba& color : table) {
+            color.red = byte();
+            color.green = byte();
+            color.blue = byte();
+            color.alpha = 255;
+        }
+        return table;
+    }
+
+private:
+    const std::vector<uint8_t>& file;
+    size_t position = 0;
+};
+
+/**
+ * @brief Decompress the LZW codes of a frame into color indices.
+ * @param data Concatenated sub-blocks of the frame.
+ * @param minimumCodeSize Code size stored before the sub-blocks.
+ * @param pixels Number of indices to produce; missing indices are left at 0.
+ * @return Color index of each pixel of the frame, in stored row order.
+ */
+std::vector<uint8_t> decompress(const std::vector<uint8_t>& data, uint8_t minimumCodeSize, size_t pixels) {
+    if (minimumCodeSize < 2 || minimumCodeSize > 8) {
+        throw std::runtime_error("Invalid LZW code size");
+    }
+
+    const int clearCode = 1 << minimumCodeSize;
+    const int endCode = clearCode + 1;
+    uint16_t prefix[MAX_CODES];
+    uint8_t suffix[MAX_CODES];
+    uint8_t firstByte[MAX_CODES];
+    uint16_t length[MAX_CODES];
+    for (int code = 0; code < clearCode; code++) {
+        suffix[code] = firstByte[code] = static_cast<uint8_t>(code);
+        length[code] = 1;
+    }
+
+    std::vector<uint8_t> output(pixels, 0);
+    size_t written = 0;
+    int codeSize = minimumCodeSize + 1;
+    int nextCode = clearCode + 2;
+    int previous = -1;
+    uint32_t buffer = 0;
+    int available = 0;
+    size_t position = 0;
+
+    while (written < pixels) {
+        while (available < codeSize && position < data.size()) {
+            buffer |= static_cast<uint32_t>(data[position++]) << available;
+            available += 8;
+        }
+        if (available < codeSize) {
+            break;
+        }
+        const int code = static_cast<int>(buffer & ((1U << codeSize) - 1));
+        buffer >>= codeSize;
+        available -= codeSize;
+
+        if (code == clearCode) {
+            codeSize = minimumCodeSize + 1;
+            nextCode = clearCode + 2;
+            previous = -1;
+            continue;
+        }
+        if (code == endCode) {
+            break;
+        }
+
+        int emitted = code;
+        if (previous < 0) {
+            if (code >= clearCode) {
+                throw std::runtime_error("LZW stream starts with an undefined code");
+            }
+        } else if (nextCode < MAX_CODES) {
+            if (code > nextCode) {
+                throw std::runtime_error("Undefined LZW code");
+            }
+            // A code equal to the next one is the previous string followed by its own first byte
+            prefix[nextCode] = static_cast<uint16_t>(previous);
+            suffix[nextCode] = code == nextCode ? firstByte[previous] : firstByte[code];
+            firstByte[nextCode] = firstByte[previous];
+            length[nextCode] = length[previous] + 1;
+            nextCode++;
+            if (nextCode == 1 << codeSize && codeSize < 12) {
+                codeSize++;
+            }
+        } else if (code >= MAX_CODES) {
+            throw std::runtime_error("Undefined LZW code");
+        }
+
+        // Strings are chained from their last byte, so write them backwards
+        const size_t end = written + length[emitted];
+        for (int c = emitted; c >= 0; c = length[c] > 1 ? prefix[c] : -1) {
+            const size_t at = written + length[c] - 1;
+            if (at < pixels) {
+                output[at] = suffix[c];
+            }
+        }
+        written = end;
+        previous = code;
+    }
+    return output;
+}
+
+/**
+ * @brief Get the stored row of each displayed row of an interlaced frame.
+ */
+std::vector<int> interlacedRows(int height) {
+    std::vector<int> rows(height);
+    int stored = 0;
+    const int starts[4] = {0, 4, 2, 1};
+    const int steps[4] = {8, 8, 4, 2};
+    for (int pass = 0; pass < 4; pass++) {
+        for (int y = starts[pass]; y < height; y += steps[pass]) {
+            rows[y] = stored++;
+        }
+    }
+    return rows;
+}
+
+}
+
+/**
+ * @brief Check whether a file starts with a GIF signature.
+ */
+bool GifReader::matches(const std::vector<uint8_t>& file) {
+    const std::string signature(file.begin(), file.begin() + (file.size() < 6 ? file.size() : 6));
+    return signature == "GIF87a" || signature == "GIF89a";
+}
+
+/**
+ * @brief Decode a GIF file.
+ */
+Bitmap GifReader::read(const std::vector<uint8_t>& file) {
+    if (!matches(file)) {
+        throw std::runtime_error("Not a GIF file");
+    }
+
+    ByteReader reader(file);
+    for (int i = 0; i < 6; i++) {
+        reader.byte();
+    }
+
+    Bitmap bitmap;
+    bitmap.width = reader.uint16();
+    bitmap.height = reader.uint16();
+    const uint8_t screenFlags = reader.byte();
+    reader.byte();  // Background color, shown as transparent
+    reader.byte();  // Pixel aspect ratio
+    if (bitmap.width == 0 || bitmap.height == 0) {
+        throw std::runtime_error("Empty GIF screen");
+    }
+    const std::vector<Rgba> globalColors = screenFlags & 0x80 ? reader.colorTable(2 << (screenFlags & 7))
+                                                              : std::vector<Rgba>();
+
+    std::vector<Rgba> canvas(static_cast<size_t>(bitmap.width) * bitmap.height);
+    uint8_t disposal = 0;
+    int transparentIndex = -1;
+
+    while (true) {
+        const uint8_t block = reader.byte();
+        if (block == 0x3B) {
+            break;
+        }
+        if (block == 0x21) {
+            const uint8_t label = reader.byte();
+            const std::vector<uint8_t> data = reader.subBlocks();
+            if (label == 0xF9 && data.size() >= 4) {
+                disposal = (data[0] >> 2) & 7;
+                transparentIndex = data[0] & 1 ? data[3] : -1;
+            }
+            continue;
+        }
+        if (block != 0x2C) {
+            throw std::runtime_error("Unknown GIF block " + std::to_string(block));
+        }
+
+        const int left = reader.uint16();
+        const int top = reader.uint16();
+        const int width = reader.uint16();
+        const int height = reader.uint16();
+        const uint8_t flags = reader.byte();
+        const std::vector<Rgba> localColors = flags & 0x80 ? reader.colorTable(2 << (flags & 7))
+                                                           : std::vector<Rgba>();
+        const std::vector<Rgba>& colors = flags & 0x80 ? localColors : globalColors;
+        const uint8_t minimumCodeSize = reader.byte();
+        const std::vector<uint8_t> indices = decompress(reader.subBlocks(), minimumCodeSize,
+                                                        static_cast<size_t>(width) * height);
+        const std::vector<int> rows = flags & 0x40 ? interlacedRows(height) : std::vector<int>();
+
+        const std::vector<Rgba> before = canvas;
+        for (int y = 0; y < height; y++) {
+            const int storedRow = rows.empty() ? y : rows[y];
+            for (int x = 0; x < width; x++) {
+                const uint8_t index = indices[static_cast<size_t>(storedRow) * width + x];
+                const int canvasX = left + x;
+                const int canvasY = top + y;
+                if (index == transparentIndex || canvasX >= bitmap.width || canvasY >= bitmap.height) {
+                    continue;
+                }
+                if (index >= colors.size()) {
+                    throw std::runtime_error("GIF pixel outside the color table");
+                }
+                canvas[static_cast<size_t>(canvasY) * bitmap.width + canvasX] = colors[index];
+            }
+        }
+        bitmap.frames.push_back(canvas);
+
+        if (disposal == RESTORE_BACKGROUND) {
+            for (int y = top; y < top + height && y < bitmap.height; y++) {
+                for (int x = left; x < left + width && x < bitmap.width; x++) {
+                    canvas[static_cast<size_t>(y) * bitmap.width + x] = Rgba();
+                }
+            }
+        } else if (disposal == RESTORE_PREVIOUS) {
+            canvas = before;
+        }
+        // The graphic control extension only applies to the frame that follows it
+        disposal = 0;
+        transparentIndex = -1;
+    }
+
+    if (bitmap.frames.empty()) {
+        throw std::runtime_error("GIF file without frames");
+    }
+    return bitmap;
+}
@@ -0,0 +1,38 @@
+/**
+ * @project OpenHoop
+ * @file GifReader.h
+ * @brief Header file for the GifReader class, a decoder of animated GIF files for the asset compiler.
+ * @details Defines the GifReader class, which decodes the frames of a GIF file and composes each one over the previous
+ * ones as the file's disposal methods require, so every frame of the Bitmap is a complete picture.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ASSETCOMPILER_GIFREADER_H
+#define OPENHOOP_ASSETCOMPILER_GIFREADER_H
+
+#include "Bitmap.h"
+
+/**
+ * @brief Decoder of GIF files, still or animated.
+ */
+class GifReader {
+public:
+    /**
+     * @brief Check whether a file starts with a GIF signature.
+     * @param file Contents of the file.
+     */
+    static bool matches(const std::vector<uint8_t>& file);
+
+    /**
+     * @brief Decode a GIF file.
+     * @details The canvas starts transparent rather than in the background color, as browsers show it.
+     * @param file Contents of the file.
+     * @return Decoded frames, the size of the logical screen.
+     * @throws std::runtime_error If the file is malformed.
+     */
+    static Bitmap read(const std::vector<uint8_t>& file);
+};
+
+#endif //OPENHOOP_ASSETCOMPILER_GIFREADER_H
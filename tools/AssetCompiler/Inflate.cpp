@@ -0,0 +1,271 @@
+/**
+ * @project OpenHoop
+ * @file Inflate.cpp
+ * @brief Source file for the Inflate class, a decompressor for the zlib streams of PNG files.
+ * @details Implements DEFLATE decoding with canonical Huffman tables decoded a bit at a time. Speed does not matter for
+ * images of a few kilobytes, so the decoder favours being short and easy to check against RFC 1951.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "Inflate.h"
+#include <stdexcept>
+
+namespace {
+
+constexpr int MAX_BITS = 15;  ///< Longest Huffman code.
+
+constexpr uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83,
+                                      99, 115, 131, 163, 195, 227, 258};
+constexpr uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5,
+                                      5, 5, 0};
+constexpr uint16_t DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+                                        1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11,
+                                        11, 12, 12, 13, 13};
+constexpr uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/**
+ * @brief Reader of a stream least significant bit first.
+ */
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size) : data(data), size(size) {}
+
+    /**
+     * @brief Read a number of bits, the first one read being the lowest.
+     */
+    uint32_t bits(int count) {
+        while (available < count) {
+            if (position >= size) {
+                throw std::runtime_error("Compressed data ends early");
+            }
+            buffer |= static_cast<uint32_t>(data[position++]) << available;
+            available += 8;
+        }
+        const uint32_t value = buffer & ((1UL << count) - 1);
+        buffer >>= count;
+        available -= count;
+        return value;
+    }
+
+    /**
+     * @brief Drop the bits left in the current byte.
+     */
+    void alignToByte() {
+        buffer = 0;
+        available = 0;
+    }
+
+    /**
+     * @brief Read a whole byte after alignToByte.
+     */
+    uint8_t byte() {
+        if (position >= size) {
+            throw std::runtime_error("Compressed data ends early");
+        }
+        return data[position++];
+    }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t position = 0;
+    uint32_t buffer = 0;
+    int available = 0;
+};
+
+/**
+ * @brief Canonical Huffman code, given by the number of codes of each length and the symbols in code order.
+ */
+struct Huffman {
+    uint16_t count[MAX_BITS + 1] = {};
+    std::vector<uint16_t> symbols;
+
+    /**
+     * @brief Build the code from the code length of each symbol, 0 for unused symbols.
+     */
+    explicit Huffman(const std::vector<uint8_t>& lengths) : symbols(lengths.size()) {
+        for (uint8_t length : lengths) {
+            count[length]++;
+        }
+        count[0] = 0;
+
+        uint16_t offsets[MAX_BITS + 1] = {};
+        for (int length = 1; length < MAX_BITS; length++) {
+            offsets[length + 1] = offsets[length] + count[length];
+        }
+        for (size_t symbol = 0; symbol < lengths.size(); symbol++) {
+            if (lengths[symbol] != 0) {
+                symbols[offsets[lengths[symbol]]++] = static_cast<uint16_t>(symbol);
+            }
+        }
+    }
+
+    /**
+     * @brief Decode a symbol, reading its code a bit at a time.
+     */
+    uint16_t decode(BitReader& reader) const {
+        int code = 0;
+        int first = 0;
+        int index = 0;
+        for (int length = 1; length <= MAX_BITS; length++) {
+            code |= static_cast<int>(reader.bits(1));
+            if (code - first < count[length]) {
+                return symbols[index + code - first];
+            }
+            index += count[length];
+            first = (first + count[length]) << 1;
+            code <<= 1;
+        }
+        throw std::runtime_error("Invalid Huffman code");
+    }
+};
+
+/**
+ * @brief Decode the symbols of a compressed block until its end.
+ */
+void inflateBlock(BitReader& reader, std::vector<uint8_t>& output, const Huffman& literals, const Huffman& distances) {
+    while (true) {
+        const uint16_t symbol = literals.decode(reader);
+        if (symbol < 256) {
+            output.push_back(static_cast<uint8_t>(symbol));
+            continue;
+        }
+        if (symbol == 256) {
+            return;
+        }
+        if (symbol > 285) {
+            throw std::runtime_error("Invalid length symbol");
+        }
+
+        const uint16_t lengthSymbol = symbol - 257;
+        const size_t length = LENGTH_BASE[lengthSymbol] + reader.bits(LENGTH_EXTRA[lengthSymbol]);
+        const uint16_t distanceSymbol = distances.decode(reader);
+        if (distanceSymbol > 29) {
+            throw std::runtime_error("Invalid distance symbol");
+        }
+        const size_t distance = DISTANCE_BASE[distanceSymbol] + reader.bits(DISTANCE_EXTRA[distanceSymbol]);
+        if (distance > output.size()) {
+            throw std::runtime_error("Distance reaches before the start of the data");
+        }
+
+        // Copy byte by byte, as the source may overlap the bytes being written
+        const size_t start = output.size() - distance;
+        for (size_t i = 0; i < length; i++) {
+            output.push_back(output[start + i]);
+        }
+    }
+}
+
+/**
+ * @brief Read the code lengths of a block with dynamic Huffman codes and decode the block.
+ */
+void inflateDynamic(BitReader& reader, std::vector<uint8_t>& output) {
+    const int literalCount = static_cast<int>(reader.bits(5)) + 257;
+    const int distanceCount = static_cast<int>(reader.bits(5)) + 1;
+    const int codeLengthCount = static_cast<int>(reader.bits(4)) + 4;
+
+    std::vector<uint8_t> codeLengthLengths(19, 0);
+    for (int i = 0; i < codeLengthCount; i++) {
+        codeLengthLengths[CODE_LENGTH_ORDER[i]] = static_cast<uint8_t>(reader.bits(3));
+    }
+    const Huffman codeLengths(codeLengthLengths);
+
+    std::vector<uint8_t> lengths;
+    while (static_cast<int>(lengths.size()) < literalCount + distanceCount) {
+        const uint16_t symbol = codeLengths.decode(reader);
+        if (symbol < 16) {
+            lengths.push_back(static_cast<uint8_t>(symbol));
+            continue;
+        }
+
+        uint8_t repeated = 0;
+        uint32_t repeat;
+        if (symbol == 16) {
+            if (lengths.empty()) {
+                throw std::runtime_error("Repeated code length without a previous one");
+            }
+            repeated = lengths.back();
+            repeat = 3 + reader.bits(2);
+        } else if (symbol == 17) {
+            repeat = 3 + reader.bits(3);
+        } else {
+            repeat = 11 + reader.bits(7);
+        }
+        lengths.insert(lengths.end(), repeat, repeated);
+    }
+    if (static_cast<int>(lengths.size()) != literalCount + distanceCount) {
+        throw std::runtime_error("Code lengths overflow the table");
+    }
+
+    const Huffman literals(std::vector<uint8_t>(lengths.begin(), lengths.begin() + literalCount));
+    const Huffman distances(std::vector<uint8_t>(lengths.begin() + literalCount, lengths.end()));
+    inflateBlock(reader, output, literals, distances);
+}
+
+/**
+ * @brief Decode a block with the fixed Huffman codes.
+ */
+void inflateFixed(BitReader& reader, std::vector<uint8_t>& output) {
+    std::vector<uint8_t> literalLengths(288);
+    for (int symbol = 0; symbol < 288; symbol++) {
+        literalLengths[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+    }
+    static const Huffman literals(literalLengths);
+    static const Huffman distances(std::vector<uint8_t>(30, 5));
+    inflateBlock(reader, output, literals, distances);
+}
+
+/**
+ * @brief Copy a stored block.
+ */
+void inflateStored(BitReader& reader, std::vector<uint8_t>& output) {
+    reader.alignToByte();
+    uint8_t header[4];
+    for (uint8_t& byte : header) {
+        byte = reader.byte();
+    }
+    const uint16_t length = header[0] | header[1] << 8;
+    const uint16_t complement = header[2] | header[3] << 8;
+    if (length != static_cast<uint16_t>(~complement)) {
+        throw std::runtime_error("Corrupt stored block length");
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        output.push_back(reader.byte());
+    }
+}
+
+}
+
+/**
+ * @brief Decompress a zlib stream.
+ * @details The Adler-32 checksum at the end of the stream is not verified; PNG files already carry a CRC per chunk.
+ */
+std::vector<uint8_t> Inflate::decompress(const uint8_t* data, size_t size) {
+    if (size < 2 || (data[0] & 0x0F) != 8 || (data[0] << 8 | data[1]) % 31 != 0 || (data[1] & 0x20) != 0) {
+        throw std::runtime_error("Not a zlib stream");
+    }
+
+    BitReader reader(data + 2, size - 2);
+    std::vector<uint8_t> output;
+    bool last = false;
+    while (!last) {
+        last = reader.bits(1) != 0;
+        switch (reader.bits(2)) {
+            case 0:
+                inflateStored(reader, output);
+                break;
+            case 1:
+                inflateFixed(reader, output);
+                break;
+            case 2:
+                inflateDynamic(reader, output);
+                break;
+            default:
+                throw std::runtime_error("Invalid block type");
+        }
+    }
+    return output;
+}
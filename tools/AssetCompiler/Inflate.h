@@ -0,0 +1,33 @@
+/**
+ * @project OpenHoop
+ * @file Inflate.h
+ * @brief Header file for the Inflate class, a decompressor for the zlib streams of PNG files.
+ * @details Defines the Inflate class, a small DEFLATE decoder so the asset compiler builds without any library.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ASSETCOMPILER_INFLATE_H
+#define OPENHOOP_ASSETCOMPILER_INFLATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @brief Decompressor for zlib streams.
+ */
+class Inflate {
+public:
+    /**
+     * @brief Decompress a zlib stream.
+     * @param data Stream, starting with its two-byte zlib header.
+     * @param size Size of the stream in bytes.
+     * @return Decompressed bytes.
+     * @throws std::runtime_error If the stream is malformed.
+     */
+    static std::vector<uint8_t> decompress(const uint8_t* data, size_t size);
+};
+
+#endif //OPENHOOP_ASSETCOMPILER_INFLATE_H
@@ -0,0 +1,274 @@
+/**
+ * @project OpenHoop
+ * @file PngReader.cpp
+ * @brief Source file for the PngReader class, a decoder of PNG files for the asset compiler.
+ * @details Implements the chunk parsing, the checks of the chunk CRCs, the reversal of the scanline filters and the
+ * conversion of every color type to RGBA, following the PNG specification.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "PngReader.h"
+#include "Inflate.h"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr uint8_t SIGNATURE[8] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};  ///< First bytes of every PNG file.
+
+enum ColorType : uint8_t {
+    GRAY = 0,
+    TRUECOLOR = 2,
+    INDEXED = 3,
+    GRAY_ALPHA = 4,
+    TRUECOLOR_ALPHA = 6,
+};
+
+/**
+ * @brief Read a big-endian 32-bit number.
+ */
+uint32_t readUint32(const uint8_t* bytes) {
+    return static_cast<uint32_t>(bytes[0]) << 24 | bytes[1] << 16 | bytes[2] << 8 | bytes[3];
+}
+
+/**
+ * @brief Compute the CRC-32 of a chunk type and data, as stored after each chunk.
+ */
+uint32_t crc32(const uint8_t* bytes, size_t size) {
+    static uint32_t table[256] = {};
+    if (table[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+    }
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+/**
+ * @brief Predict a byte with the Paeth filter from its left, upper and upper-left neighbours.
+ */
+uint8_t paeth(uint8_t left, uint8_t up, uint8_t upLeft) {
+    const int estimate = left + up - upLeft;
+    const int toLeft = std::abs(estimate - left);
+    const int toUp = std::abs(estimate - up);
+    const int toUpLeft = std::abs(estimate - upLeft);
+    if (toLeft <= toUp && toLeft <= toUpLeft) {
+        return left;
+    }
+    return toUp <= toUpLeft ? up : upLeft;
+}
+
+/**
+ * @brief Reverse the filter of every scanline in place, dropping the filter bytes.
+ * @param data Decompressed scanlines, each preceded by its filter type.
+ * @param stride Bytes per scanline without the filter byte.
+ * @param height Number of scanlines.
+ * @param pixelBytes Bytes per pixel, at least one.
+ * @return Unfiltered scanlines.
+ */
+std::vector<uint8_t> unfilter(const std::vector<uint8_t>& data, size_t stride, int height, size_t pixelBytes) {
+    if (data.size() < (stride + 1) * height) {
+        throw std::runtime_error("Image data ends early");
+    }
+
+    std::vector<uint8_t> rows(stride * height);
+    for (int y = 0; y < height; y++) {
+        const uint8_t filter = data[y * (stride + 1)];
+        const uint8_t* in = &data[y * (stride + 1) + 1];
+        uint8_t* out = &rows[y * stride];
+        const uint8_t* previous = y > 0 ? out - stride : nullptr;
+
+        for (size_t i = 0; i < stride; i++) {
+            const uint8_t left = i >= pixelBytes ? out[i - pixelBytes] : 0;
+            const uint8_t up = previous ? previous[i] : 0;
+            const uint8_t upLeft = previous && i >= pixelBytes ? previous[i - pixelBytes] : 0;
+            switch (filter) {
+                case 0:
+                    out[i] = in[i];
+                    break;
+                case 1:
+                    out[i] = in[i] + left;
+                    break;
+                case 2:
+                    out[i] = in[i] + up;
+                    break;
+                case 3:
+                    out[i] = in[i] + (left + up) / 2;
+                    break;
+                case 4:
+                    out[i] = in[i] + paeth(left, up, upLeft);
+                    break;
+                default:
+                    throw std::runtime_error("Invalid scanline filter " + std::to_string(filter));
+            }
+        }
+    }
+    return rows;
+}
+
+/**
+ * @brief Read a sample of a scanline, most significant bits first for depths below 8.
+ */
+uint16_t sample(const uint8_t* row, size_t index, uint8_t depth) {
+    if (depth == 16) {
+        return row[index * 2] << 8 | row[index * 2 + 1];
+    }
+    if (depth == 8) {
+        return row[index];
+    }
+    const size_t bit = index * depth;
+    return (row[bit / 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1);
+}
+
+}
+
+/**
+ * @brief Check whether a file starts with the PNG signature.
+ */
+bool PngReader::matches(const std::vector<uint8_t>& file) {
+    return file.size() >= sizeof(SIGNATURE) && std::equal(SIGNATURE, SIGNATURE + sizeof(SIGNATURE), file.begin());
+}
+
+/**
+ * @brief Decode a PNG file.
+ */
+Bitmap PngReader::read(const std::vector<uint8_t>& file) {
+    if (!matches(file)) {
+        throw std::runtime_error("Not a PNG file");
+    }
+
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint8_t depth = 0;
+    uint8_t colorType = 0;
+    std::vector<Rgba> palette;
+    std::vector<uint8_t> transparency;
+    std::vector<uint8_t> compressed;
+
+    size_t position = sizeof(SIGNATURE);
+    bool ended = false;
+    while (!ended) {
+        if (position + 12 > file.size()) {
+            throw std::runtime_error("PNG file ends early");
+        }
+        const uint32_t length = readUint32(&file[position]);
+        if (length > file.size() - position - 12) {
+            throw std::runtime_error("PNG chunk overflows the file");
+        }
+        const std::string type(file.begin() + position + 4, file.begin() + position + 8);
+        const uint8_t* data = &file[position + 8];
+        if (crc32(&file[position + 4], length + 4) != readUint32(data + length)) {
+            throw std::runtime_error("Corrupt PNG chunk " + type);
+        }
+        position += length + 12;
+
+        if (type == "IHDR") {
+            if (length < 13) {
+                throw std::runtime_error("Corrupt PNG header");
+            }
+            width = readUint32(data);
+            height = readUint32(data + 4);
+            depth = data[8];
+            colorType = data[9];
+            if (data[12] != 0) {
+                throw std::runtime_error("Interlaced PNG files are not supported, save the image without interlacing");
+            }
+        } else if (type == "PLTE") {
+            for (uint32_t i = 0; i + 2 < length; i += 3) {
+                palette.push_back({data[i], data[i + 1], data[i + 2], 255});
+            }
+        } else if (type == "tRNS") {
+            transparency.assign(data, data + length);
+        } else if (type == "IDAT") {
+            compressed.insert(compressed.end(), data, data + length);
+        } else if (type == "IEND") {
+            ended = true;
+        }
+    }
+
+    uint8_t channels;
+    switch (colorType) {
+        case GRAY:
+        case INDEXED:
+            channels = 1;
+            break;
+        case GRAY_ALPHA:
+            channels = 2;
+            break;
+        case TRUECOLOR:
+            channels = 3;
+            break;
+        case TRUECOLOR_ALPHA:
+            channels = 4;
+            break;
+        default:
+            throw std::runtime_error("Invalid PNG color type");
+    }
+    if (width == 0 || height == 0 || width > 4096 || height > 4096 ||
+        (depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16)) {
+        throw std::runtime_error("Unsupported PNG size or bit depth");
+    }
+
+    const size_t pixelBits = static_cast<size_t>(channels) * depth;
+    const size_t stride = (width * pixelBits + 7) / 8;
+    const std::vector<uint8_t> rows = unfilter(Inflate::decompress(compressed.data(), compressed.size()), stride,
+                                               static_cast<int>(height), pixelBits >= 8 ? pixelBits / 8 : 1);
+
+    for (size_t i = 0; i < transparency.size() && i < palette.size() && colorType == INDEXED; i++) {
+        palette[i].alpha = transparency[i];
+    }
+    // Transparent color key of the gray and truecolor types, as 16-bit samples
+    const bool keyed = transparency.size() >= (colorType == GRAY ? 2u : 6u) &&
+                       (colorType == GRAY || colorType == TRUECOLOR);
+    const auto key = [&](int channel) { return transparency[channel * 2] << 8 | transparency[channel * 2 + 1]; };
+
+    const int shift = depth == 16 ? 8 : 0;
+    const int maximum = depth >= 8 ? 255 : (1 << depth) - 1;
+    Bitmap bitmap;
+    bitmap.width = static_cast<int>(width);
+    bitmap.height = static_cast<int>(height);
+    bitmap.frames.emplace_back(width * height);
+    std::vector<Rgba>& pixels = bitmap.frames.back();
+
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t* row = &rows[y * stride];
+        for (uint32_t x = 0; x < width; x++) {
+            Rgba& pixel = pixels[y * width + x];
+            uint16_t s[4];
+            for (uint8_t c = 0; c < channels; c++) {
+                s[c] = sample(row, x * channels + c, depth);
+            }
+
+            if (colorType == INDEXED) {
+                if (s[0] >= palette.size()) {
+                    throw std::runtime_error("PNG pixel outside the palette");
+                }
+                pixel = palette[s[0]];
+            } else if (colorType == GRAY || colorType == GRAY_ALPHA) {
+                const auto gray = static_cast<uint8_t>((s[0] >> shift) * 255 / maximum);
+                const bool clear = keyed && s[0] == key(0);
+                pixel = {gray, gray, gray, static_cast<uint8_t>(colorType == GRAY_ALPHA ? s[1] >> shift :
+                                                                clear ? 0 : 255)};
+            } else {
+                const bool clear = keyed && s[0] == key(0) && s[1] == key(1) && s[2] == key(2);
+                pixel = {static_cast<uint8_t>(s[0] >> shift), static_cast<uint8_t>(s[1] >> shift),
+                         static_cast<uint8_t>(s[2] >> shift),
+                         static_cast<uint8_t>(colorType == TRUECOLOR_ALPHA ? s[3] >> shift : clear ? 0 : 255)};
+            }
+        }
+    }
+    return bitmap;
+}
@@ -0,0 +1,38 @@
+/**
+ * @project OpenHoop
+ * @file PngReader.h
+ * @brief Header file for the PngReader class, a decoder of PNG files for the asset compiler.
+ * @details Defines the PngReader class, which decodes indexed, grayscale and truecolor PNG files, with or without
+ * transparency, into a single-frame Bitmap.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ASSETCOMPILER_PNGREADER_H
+#define OPENHOOP_ASSETCOMPILER_PNGREADER_H
+
+#include "Bitmap.h"
+
+/**
+ * @brief Decoder of PNG files.
+ */
+class PngReader {
+public:
+    /**
+     * @brief Check whether a file starts with the PNG signature.
+     * @param file Contents of the file.
+     */
+    static bool matches(const std::vector<uint8_t>& file);
+
+    /**
+     * @brief Decode a PNG file.
+     * @details Every bit depth and color type is supported. Interlaced files are not.
+     * @param file Contents of the file.
+     * @return Decoded image, with a single frame.
+     * @throws std::runtime_error If the file is malformed or interlaced.
+     */
+    static Bitmap read(const std::vector<uint8_t>& file);
+};
+
+#endif //OPENHOOP_ASSETCOMPILER_PNGREADER_H
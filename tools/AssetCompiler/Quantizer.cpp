@@ -0,0 +1,202 @@
+/**
+ * @project OpenHoop
+ * @file Quantizer.cpp
+ * @brief Source file for the Quantizer class, which reduces decoded images to a small palette.
+ * @details Implements the color histogram, the median cut and the mapping of each pixel to its nearest palette color.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "Quantizer.h"
+#include <algorithm>
+#include <map>
+
+namespace {
+
+/**
+ * @brief Color of the histogram and the number of pixels that have it.
+ */
+struct ColorCount {
+    uint8_t channel[3];
+    uint64_t count;
+};
+
+/**
+ * @brief Group of histogram colors replaced by a single palette color.
+ */
+struct Box {
+    std::vector<ColorCount> colors;
+
+    uint64_t total() const {
+        uint64_t sum = 0;
+        for (const ColorCount& color : colors) {
+            sum += color.count;
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Get the channel with the widest range of values, and that range.
+     */
+    int widestChannel(int& range) const {
+        int widest = 0;
+        range = -1;
+        for (int c = 0; c < 3; c++) {
+            int low = 255;
+            int high = 0;
+            for (const ColorCount& color : colors) {
+                low = std::min<int>(low, color.channel[c]);
+                high = std::max<int>(high, color.channel[c]);
+            }
+            if (high - low > range) {
+                range = high - low;
+                widest = c;
+            }
+        }
+        return widest;
+    }
+
+    /**
+     * @brief Get the average color of the pixels of the box.
+     */
+    Rgba average() const {
+        uint64_t sums[3] = {};
+        const uint64_t pixels = total();
+        for (const ColorCount& color : colors) {
+            for (int c = 0; c < 3; c++) {
+                sums[c] += color.channel[c] * color.count;
+            }
+        }
+        Rgba rgba;
+        rgba.red = static_cast<uint8_t>((sums[0] + pixels / 2) / pixels);
+        rgba.green = static_cast<uint8_t>((sums[1] + pixels / 2) / pixels);
+        rgba.blue = static_cast<uint8_t>((sums[2] + pixels / 2) / pixels);
+        rgba.alpha = 255;
+        return rgba;
+    }
+};
+
+/**
+ * @brief Split boxes by median cut until there are enough of them or none can be split.
+ */
+std::vector<Box> medianCut(const std::vector<ColorCount>& histogram, int boxCount) {
+    std::vector<Box> boxes(1);
+    boxes[0].colors = histogram;
+
+    while (static_cast<int>(boxes.size()) < boxCount) {
+        // Split the box with the widest channel range
+        int best = -1;
+        int bestRange = 0;
+        for (size_t i = 0; i < boxes.size(); i++) {
+            int range;
+            boxes[i].widestChannel(range);
+            if (boxes[i].colors.size() > 1 && range > bestRange) {
+                best = static_cast<int>(i);
+                bestRange = range;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+
+        Box& box = boxes[best];
+        int range;
+        const int channel = box.widestChannel(range);
+        std::sort(box.colors.begin(), box.colors.end(), [channel](const ColorCount& a, const ColorCount& b) {
+            return a.channel[channel] < b.channel[channel];
+        });
+
+        // Cut at the median pixel, keeping at least one color on each side
+        const uint64_t half = box.total() / 2;
+        uint64_t seen = 0;
+        size_t cut = 1;
+        for (size_t i = 0; i + 1 < box.colors.size(); i++) {
+            seen += box.colors[i].count;
+            cut = i + 1;
+            if (seen >= half) {
+                break;
+            }
+        }
+
+        Box upper;
+        upper.colors.assign(box.colors.begin() + static_cast<long>(cut), box.colors.end());
+        box.colors.resize(cut);
+        boxes.push_back(upper);
+    }
+    return boxes;
+}
+
+}
+
+/**
+ * @brief Reduce the colors of an image to a shared palette.
+ */
+IndexedImage Quantizer::quantize(const Bitmap& bitmap, int maxColors) {
+    maxColors = std::max(1, std::min(15, maxColors));
+
+    std::map<uint32_t, uint64_t> counts;
+    for (const std::vector<Rgba>& frame : bitmap.frames) {
+        for (const Rgba& pixel : frame) {
+            if (pixel.alpha >= 128) {
+                counts[static_cast<uint32_t>(pixel.red) << 16 | pixel.green << 8 | pixel.blue]++;
+            }
+        }
+    }
+    std::vector<ColorCount> histogram;
+    for (const auto& entry : counts) {
+        histogram.push_back({{static_cast<uint8_t>(entry.first >> 16), static_cast<uint8_t>(entry.first >> 8),
+                              static_cast<uint8_t>(entry.first)}, entry.second});
+    }
+
+    // Each box becomes a palette color, the most used first
+    std::vector<std::pair<uint64_t, Rgba>> colors;
+    if (!histogram.empty()) {
+        for (const Box& box : medianCut(histogram, maxColors)) {
+            colors.emplace_back(box.total(), box.average());
+        }
+    }
+    std::stable_sort(colors.begin(), colors.end(), [](const std::pair<uint64_t, Rgba>& a,
+                                                      const std::pair<uint64_t, Rgba>& b) {
+        return a.first > b.first;
+    });
+
+    IndexedImage image;
+    image.width = bitmap.width;
+    image.height = bitmap.height;
+    image.palette.push_back(Rgba());
+    for (const auto& color : colors) {
+        image.palette.push_back(color.second);
+    }
+
+    std::map<uint32_t, uint8_t> nearest;
+    for (const std::vector<Rgba>& frame : bitmap.frames) {
+        std::vector<uint8_t> indices(frame.size(), 0);
+        for (size_t i = 0; i < frame.size(); i++) {
+            const Rgba& pixel = frame[i];
+            if (pixel.alpha < 128) {
+                continue;
+            }
+            const uint32_t key = static_cast<uint32_t>(pixel.red) << 16 | pixel.green << 8 | pixel.blue;
+            auto found = nearest.find(key);
+            if (found == nearest.end()) {
+                uint8_t best = 1;
+                int bestDistance = INT32_MAX;
+                for (size_t p = 1; p < image.palette.size(); p++) {
+                    const int dr = pixel.red - image.palette[p].red;
+                    const int dg = pixel.green - image.palette[p].green;
+                    const int db = pixel.blue - image.palette[p].blue;
+                    const int distance = dr * dr + dg * dg + db * db;
+                    if (distance < bestDistance) {
+                        best = static_cast<uint8_t>(p);
+                        bestDistance = distance;
+                    }
+                }
+                found = nearest.emplace(key, best).first;
+            }
+            indices[i] = found->second;
+        }
+        image.frames.push_back(indices);
+    }
+    return image;
+}
@@ -0,0 +1,45 @@
+/**
+ * @project OpenHoop
+ * @file Quantizer.h
+ * @brief Header file for the Quantizer class, which reduces decoded images to a small palette.
+ * @details Defines the IndexedImage struct, the palette-indexed form of an image written by the asset compiler, and the
+ * Quantizer class, which builds it with a palette shared by every frame.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ASSETCOMPILER_QUANTIZER_H
+#define OPENHOOP_ASSETCOMPILER_QUANTIZER_H
+
+#include "Bitmap.h"
+
+/**
+ * @brief Frames of palette indices with their palette, index 0 being transparent.
+ */
+struct IndexedImage {
+    int width = 0;   ///< Width of the frames.
+    int height = 0;  ///< Height of the frames.
+    std::vector<Rgba> palette;  ///< Colors of the indices, the first one transparent.
+    std::vector<std::vector<uint8_t>> frames;  ///< Palette index of each pixel of each frame, row by row.
+};
+
+/**
+ * @brief Reduction of images to a small palette.
+ */
+class Quantizer {
+public:
+    /**
+     * @brief Reduce the colors of an image to a shared palette.
+     * @details Pixels less than half opaque become transparent and the others opaque. When the image has more opaque
+     * colors than allowed, they are grouped by median cut, splitting the group with the widest channel range at the
+     * median pixel until there are enough groups, and each group is replaced by its average color. Colors are ordered
+     * from the most to the least used.
+     * @param bitmap Decoded image.
+     * @param maxColors Maximum number of opaque colors, from 1 to 15.
+     * @return Indexed image, with at most maxColors + 1 palette entries.
+     */
+    static IndexedImage quantize(const Bitmap& bitmap, int maxColors);
+};
+
+#endif //OPENHOOP_ASSETCOMPILER_QUANTIZER_H
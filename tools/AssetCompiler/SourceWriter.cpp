@@ -0,0 +1,239 @@
+/**
+ * @project OpenHoop
+ * @file SourceWriter.cpp
+ * @brief Source file for the SourceWriter class, which turns indexed images into firmware image classes.
+ * @details Implements the measurement of the storage formats and the generation of the image class files.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include "SourceWriter.h"
+#include <cctype>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Count the runs of an image as encodeRuns lays them out, skipping the columns unchanged from the last frame.
+ */
+size_t countRuns(const IndexedImage& image) {
+    size_t runs = 0;
+    for (size_t f = 0; f < image.frames.size(); f++) {
+        const std::vector<uint8_t>& frame = image.frames[f];
+        for (int x = 0; x < image.width; x++) {
+            bool unchanged = f > 0;
+            for (int y = 0; y < image.height && unchanged; y++) {
+                unchanged = frame[y * image.width + x] == image.frames[f - 1][y * image.width + x];
+            }
+            if (unchanged) {
+                continue;
+            }
+
+            int length = 0;
+            for (int y = 0; y < image.height; y++) {
+                if (length == 0 || length == 16 || frame[y * image.width + x] != frame[(y - 1) * image.width + x]) {
+                    runs++;
+                    length = 0;
+                }
+                length++;
+            }
+        }
+    }
+    return runs;
+}
+
+/**
+ * @brief Get today's date as written in the file headers.
+ */
+std::string today() {
+    const std::time_t now = std::time(nullptr);
+    char date[16];
+    std::strftime(date, sizeof(date), "%Y-%m-%d", std::localtime(&now));
+    return date;
+}
+
+/**
+ * @brief Write the palette as the initializer list of the LedImage constructor, wrapped under the opening brace.
+ * @param image Indexed image.
+ * @param column Column of the opening brace.
+ */
+std::string paletteList(const IndexedImage& image, size_t column) {
+    std::ostringstream out;
+    out << "{LedColor()";
+    size_t lineLength = column + 11;
+    for (size_t i = 1; i < image.palette.size(); i++) {
+        const std::string color = "LedColor(" + std::to_string(image.palette[i].red) + ", " +
+                                  std::to_string(image.palette[i].green) + ", " +
+                                  std::to_string(image.palette[i].blue) + ")";
+        if (lineLength + color.size() + 4 > 120) {
+            out << ",\n" << std::string(column + 1, ' ');
+            lineLength = column + 1;
+        } else {
+            out << ", ";
+            lineLength += 2;
+        }
+        out << color;
+        lineLength += color.size();
+    }
+    out << "}";
+    return out.str();
+}
+
+/**
+ * @brief Write a frame of palette indices as rows of a table.
+ */
+void writeRows(std::ostream& out, const IndexedImage& image, const std::vector<uint8_t>& frame,
+               const std::string& indent) {
+    for (int y = 0; y < image.height; y++) {
+        out << indent << "{";
+        for (int x = 0; x < image.width; x++) {
+            const int index = frame[y * image.width + x];
+            out << (index < 10 ? " " : "") << index << (x + 1 < image.width ? ", " : "");
+        }
+        out << "},\n";
+    }
+}
+
+/**
+ * @brief Open a file for writing.
+ */
+std::ofstream create(const std::string& path) {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+    return file;
+}
+
+}
+
+/**
+ * @brief Measure the storage formats that can hold an image.
+ */
+std::vector<Variant> SourceWriter::measure(const IndexedImage& image) {
+    std::vector<Variant> variants;
+    const size_t pixels = static_cast<size_t>(image.width) * image.height;
+    if (image.frames.size() == 1) {
+        for (uint8_t bits : {1, 2, 4, 8}) {
+            if (image.palette.size() <= (1U << bits)) {
+                variants.push_back({"packed" + std::to_string(bits), bits, (pixels * bits + 7) / 8});
+            }
+        }
+    }
+    const size_t offsets = image.frames.size() * image.width * sizeof(uint16_t);
+    variants.push_back({"rle", 0, countRuns(image) + offsets});
+    return variants;
+}
+
+/**
+ * @brief Write the header and source file of an image class.
+ */
+void SourceWriter::write(const IndexedImage& image, const std::string& className, const Variant& variant,
+                         const std::string& root, const std::string& inputName) {
+    const bool rle = variant.bits == 0;
+    const std::string base = rle ? "RleImage" : "LedImage";
+    std::string guard = "OPENHOOP_";
+    for (char c : className) {
+        guard += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    guard += "_H";
+
+    std::ofstream header = create(root + "/include/images/" + className + ".h");
+    header << "/**\n"
+              " * @project OpenHoop\n"
+              " * @file " << className << ".h\n"
+              " * @brief Header file for the " << className << " class, generated from " << inputName << ".\n"
+              " * @details Defines the " << className << " class, a derived class from " << base
+           << " whose pixels are stored in flash.\n"
+              " * Generated by tools/AssetCompiler; regenerate it instead of editing it.\n"
+              " * @author github.com/angelcamelot\n"
+              " * @date " << today() << "\n"
+              " * @license Open-source license.\n"
+              " */\n"
+              "\n"
+              "#ifndef " << guard << "\n"
+              "#define " << guard << "\n"
+              "\n"
+              "#include \"" << base << ".h\"\n"
+              "\n"
+              "/**\n"
+              " * @brief Represents the image of " << inputName << " for the Hula Hoop LED display.\n"
+              " */\n"
+              "class " << className << " : public " << base << " {\n"
+              "public:\n"
+              "    /**\n"
+              "     * @brief Constructor for the " << className << " class.\n"
+              "     */\n"
+              "    " << className << "();\n"
+              "};\n"
+              "\n"
+              "#endif //" << guard << "\n";
+
+    std::ofstream source = create(root + "/src/images/" + className + ".cpp");
+    source << "/**\n"
+              " * @project OpenHoop\n"
+              " * @file " << className << ".cpp\n"
+              " * @brief Source file for the " << className << " class, generated from " << inputName << ".\n"
+              " * @details " << (rle ? "Run-length encodes" : "Packs") << " the image into flash and passes its colors to "
+           << base << ".\n"
+              " * Generated by tools/AssetCompiler; regenerate it instead of editing it.\n"
+              " * @author github.com/angelcamelot\n"
+              " * @date " << today() << "\n"
+              " * @license Open-source license.\n"
+              " */\n"
+              "\n"
+              "#include \"../../include/images/" << className << ".h\"\n"
+              "\n"
+              "namespace {\n"
+              "\n";
+    if (rle) {
+        source << "constexpr int FRAMES = " << image.frames.size() << ";  ///< Number of frames.\n";
+    }
+    source << "constexpr int WIDTH = " << image.width << ";   ///< Width of the image.\n"
+              "constexpr int HEIGHT = " << image.height << ";  ///< Height of the image.\n"
+              "\n"
+              "/**\n"
+              " * @brief Palette index of each pixel, " << (rle ? "frame by frame and " : "") << "row by row, 0 being "
+              "transparent. Only read while " << (rle ? "encoding" : "packing") << " at compile time.\n"
+              " */\n";
+    if (rle) {
+        source << "constexpr uint8_t PIXELS[FRAMES][HEIGHT][WIDTH] = {\n";
+        for (const std::vector<uint8_t>& frame : image.frames) {
+            source << "        {\n";
+            writeRows(source, image, frame, "                ");
+            source << "        },\n";
+        }
+        source << "};\n"
+                  "\n"
+                  "/**\n"
+                  " * @brief Pixels encoded as runs, the only copy kept in flash (" << variant.bytes << " bytes).\n"
+                  " */\n"
+                  "constexpr auto RLE = encodeRuns<countRuns(PIXELS)>(PIXELS);\n";
+    } else {
+        source << "constexpr uint8_t PIXELS[HEIGHT][WIDTH] = {\n";
+        writeRows(source, image, image.frames[0], "        ");
+        source << "};\n"
+                  "\n"
+                  "/**\n"
+                  " * @brief Pixels packed at " << +variant.bits << " bits each, the only copy kept in flash ("
+               << variant.bytes << " bytes).\n"
+                  " */\n"
+                  "constexpr auto PACKED = packPixels<" << +variant.bits << ">(PIXELS);\n";
+    }
+
+    const std::string call = rle ? "    : RleImage(WIDTH, HEIGHT, FRAMES, RLE.offsets, RLE.runs, "
+                                 : "    : LedImage(WIDTH, HEIGHT, " + std::to_string(variant.bits) + ", PACKED.data, ";
+    source << "\n"
+              "}\n"
+              "\n"
+              "/**\n"
+              " * @brief Constructor for " << className << ".\n"
+              " * The palette entries follow the indices of the pixel table.\n"
+              " */\n"
+           << className << "::" << className << "()\n"
+           << call << paletteList(image, call.size()) << ") {}\n";
+}
@@ -0,0 +1,57 @@
+/**
+ * @project OpenHoop
+ * @file SourceWriter.h
+ * @brief Header file for the SourceWriter class, which turns indexed images into firmware image classes.
+ * @details Defines the Variant struct, the flash footprint of an image in one of the storage formats of the firmware,
+ * and the SourceWriter class, which measures every format and writes the header and source file of an image class
+ * stored in the chosen one.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#ifndef OPENHOOP_ASSETCOMPILER_SOURCEWRITER_H
+#define OPENHOOP_ASSETCOMPILER_SOURCEWRITER_H
+
+#include <string>
+#include "Quantizer.h"
+
+/**
+ * @brief Flash footprint of an image in a storage format.
+ */
+struct Variant {
+    std::string name;  ///< Name of the format, "rle" or "packed" followed by the bits per pixel.
+    uint8_t bits;      ///< Bits per pixel of packed variants, 0 for the run-length encoded one.
+    size_t bytes;      ///< Bytes of flash taken by the pixels.
+};
+
+/**
+ * @brief Writer of the image classes of the firmware.
+ */
+class SourceWriter {
+public:
+    /**
+     * @brief Measure the storage formats that can hold an image.
+     * @details Packed variants are listed for every bit depth wide enough for the palette, and only for still images.
+     * The run-length encoded variant counts the runs and column offsets exactly as encodeRuns lays them out.
+     * @param image Indexed image.
+     * @return Available variants.
+     */
+    static std::vector<Variant> measure(const IndexedImage& image);
+
+    /**
+     * @brief Write the header and source file of an image class.
+     * @details The files follow the layout of the hand-written images: the palette indices as a table read row by
+     * row, encoded at compile time by packPixels or encodeRuns, and the palette passed to the constructor.
+     * @param image Indexed image.
+     * @param className Name of the class, also used for the file names.
+     * @param variant Storage format, as returned by measure.
+     * @param root Root of the repository, holding the include/images and src/images directories.
+     * @param inputName Name of the image file, mentioned in the generated comments.
+     * @throws std::runtime_error If a file cannot be written.
+     */
+    static void write(const IndexedImage& image, const std::string& className, const Variant& variant,
+                      const std::string& root, const std::string& inputName);
+};
+
+#endif //OPENHOOP_ASSETCOMPILER_SOURCEWRITER_H
@@ -0,0 +1,127 @@
+/**
+ * @project OpenHoop
+ * @file main.cpp
+ * @brief Main program file of the asset compiler, a host tool turning PNG and GIF files into image classes.
+ * @details Reads an image file, reduces it to a palette of up to 15 colors plus transparency, reports the flash taken
+ * by every storage format the firmware supports, and writes the image class in the smallest one or the one requested.
+ * It runs on the computer, not the hoop: build it from the sources of this directory with any C++14 compiler.
+ * @author github.com/angelcamelot
+ * @date 2026-10-19
+ * @license Open-source license.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include "GifReader.h"
+#include "PngReader.h"
+#include "Quantizer.h"
+#include "SourceWriter.h"
+
+namespace {
+
+constexpr int MAX_HEIGHT = 64;  ///< Tallest column the firmware decodes, LedImage::MAX_HEIGHT.
+
+/**
+ * @brief Print the usage of the tool.
+ */
+void printUsage() {
+    std::cerr << "Usage: AssetCompiler <image.png|image.gif> <ClassName> [options]\n"
+                 "Options:\n"
+                 "  --colors N      Maximum number of opaque colors, 1 to 15 (default 15)\n"
+                 "  --format F      auto, rle or packed (default auto, the smallest)\n"
+                 "  --root DIR      Repository root holding include/images and src/images (default .)\n";
+}
+
+/**
+ * @brief Get the file name of a path, without its directories.
+ */
+std::string fileName(const std::string& path) {
+    const size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+
+    const std::string input = argv[1];
+    const std::string className = argv[2];
+    int maxColors = 15;
+    std::string format = "auto";
+    std::string root = ".";
+    for (int i = 3; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--colors") {
+            maxColors = std::atoi(argv[i + 1]);
+        } else if (option == "--format") {
+            format = argv[i + 1];
+        } else if (option == "--root") {
+            root = argv[i + 1];
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if ((argc - 3) % 2 != 0 || maxColors < 1 || maxColors > 15 ||
+        (format != "auto" && format != "rle" && format != "packed")) {
+        printUsage();
+        return 1;
+    }
+
+    try {
+        std::ifstream stream(input, std::ios::binary);
+        if (!stream) {
+            throw std::runtime_error("Cannot read " + input);
+        }
+        const std::vector<uint8_t> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        Bitmap bitmap;
+        if (PngReader::matches(file)) {
+            bitmap = PngReader::read(file);
+        } else if (GifReader::matches(file)) {
+            bitmap = GifReader::read(file);
+        } else {
+            throw std::runtime_error(input + " is neither a PNG nor a GIF file");
+        }
+
+        const IndexedImage image = Quantizer::quantize(bitmap, maxColors);
+        std::cout << fileName(input) << ": " << image.width << "x" << image.height << ", " << image.frames.size()
+                  << (image.frames.size() == 1 ? " frame, " : " frames, ") << image.palette.size() - 1
+                  << " colors\n";
+        if (image.height > MAX_HEIGHT) {
+            std::cout << "Warning: columns taller than " << MAX_HEIGHT << " pixels are cut when shown\n";
+        }
+
+        const std::vector<Variant> variants = SourceWriter::measure(image);
+        const Variant* chosen = nullptr;
+        for (const Variant& variant : variants) {
+            std::cout << "  " << variant.name << ": " << variant.bytes << " bytes\n";
+            if ((format == "rle" && variant.bits != 0) || (format == "packed" && variant.bits == 0)) {
+                continue;
+            }
+            if (!chosen || variant.bytes < chosen->bytes) {
+                chosen = &variant;
+            }
+        }
+        if (!chosen) {
+            throw std::runtime_error("Animations can only be stored as runs, use --format rle");
+        }
+        if (chosen->bits == 0 && variants.back().bytes - image.frames.size() * image.width * 2 > 0xFFFF) {
+            throw std::runtime_error("Too many runs for 16-bit offsets, split the animation");
+        }
+
+        SourceWriter::write(image, className, *chosen, root, fileName(input));
+        std::cout << "Wrote " << className << " as " << chosen->name << " (" << chosen->bytes << " bytes)\n";
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << "\n";
+        return 1;
+    }
+    return 0;
+}